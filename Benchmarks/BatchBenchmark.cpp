@@ -0,0 +1,130 @@
+/**
+	Measures the throughput of the batch simulation in game-ticks per second on one core,
+	compared with stepping the same games one GameState at a time
+	Finished games are reset with a new seed right away, so the batch stays full. Two policies:
+	random turns (short games, resets are frequent) and following a Hamiltonian cycle (long games which are won)
+	Both runs play exactly the same games, which is checked through the total score
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "BatchSimulation.h"
+#include <cstdio>
+#include <vector>
+
+using Action = SimulationBase::Action;
+
+namespace {
+	constexpr int GAMES = 4096;
+	constexpr int STEPS = 4000;
+
+	/**
+		Turns to a random direction on 1 in 8 ticks, otherwise keeps going
+	*/
+	Action randomPolicy(std::uint64_t seed, std::uint64_t tick, Vec2_<int>)
+	{
+		const std::uint64_t bits = CounterRng(seed)(tick);
+		return (bits & 7) == 0 ? Action(1 + ((bits >> 3) & 3)) : Action::None;
+	}
+
+	/**
+		Follows the benchmark cycle, which wins every game
+	*/
+	Action cyclePolicy(std::uint64_t, std::uint64_t, Vec2_<int> head)
+	{
+		return SimulationBase::toAction(Benchmark::nextOnCycle(head, Grid::CLASSIC_WIDTH, Grid::CLASSIC_HEIGHT) - head);
+	}
+
+	struct Result {
+		std::uint64_t ticks = 0;
+		std::int64_t score = 0;
+		double seconds = 0.0;
+	};
+
+	template<typename Policy>
+	Result runBatch(Policy policy)
+	{
+		ClassicBatchSimulation batch(GAMES);
+		std::vector<std::uint64_t> seeds(GAMES);
+		std::vector<Action> actions(GAMES);
+		std::uint64_t nextSeed = 0;
+		for (std::uint64_t& seed : seeds) {
+			seed = nextSeed++;
+		}
+		batch.resetAll(seeds.data());
+
+		Result result;
+		Benchmark::Stopwatch watch;
+		for (int s = 0; s < STEPS; ++s) {
+			for (int i = 0; i < GAMES; ++i) {
+				actions[i] = policy(seeds[i], batch.getTick(i), batch.getHeadLocation(i));
+			}
+			batch.step(actions.data());
+			result.ticks += GAMES;
+			for (int i = 0; i < GAMES; ++i) {
+				if (batch.isGameOver(i)) {
+					result.score += batch.getScore(i);
+					seeds[i] = nextSeed++;
+					batch.reset(i, seeds[i]);
+				}
+			}
+		}
+		result.seconds = watch.getSeconds();
+		return result;
+	}
+
+	template<typename Policy>
+	Result runSequential(Policy policy)
+	{
+		std::vector<GameState> games(GAMES);
+		std::vector<std::uint64_t> seeds(GAMES);
+		std::uint64_t nextSeed = 0;
+		for (int i = 0; i < GAMES; ++i) {
+			seeds[i] = nextSeed++;
+			games[i].reset(seeds[i]);
+		}
+
+		Result result;
+		Benchmark::Stopwatch watch;
+		for (int s = 0; s < STEPS; ++s) {
+			for (int i = 0; i < GAMES; ++i) {
+				GameState& game = games[i];
+				game.step(policy(seeds[i], game.getTick(), game.getSnake().getHeadLocation()));
+				if (game.isGameOver()) {
+					result.score += game.getScore();
+					seeds[i] = nextSeed++;
+					game.reset(seeds[i]);
+				}
+			}
+			result.ticks += GAMES;
+		}
+		result.seconds = watch.getSeconds();
+		return result;
+	}
+
+	template<typename Policy>
+	bool compare(const char* name, Policy policy)
+	{
+		const Result batch = runBatch(policy);
+		const Result sequential = runSequential(policy);
+		const double batchRate = batch.ticks / batch.seconds;
+		const double sequentialRate = sequential.ticks / sequential.seconds;
+		std::printf("%8s %18.3e %18.3e %10.2fx\n", name, batchRate, sequentialRate, batchRate / sequentialRate);
+		if (batch.score != sequential.score) {
+			std::printf("score mismatch: batch %lld, sequential %lld\n", (long long)batch.score, (long long)sequential.score);
+			return false;
+		}
+		return true;
+	}
+}
+
+int main()
+{
+	std::printf("%d games of 20x11, %d steps, one core\n", GAMES, STEPS);
+	std::printf("%8s %18s %18s %11s\n", "policy", "batch ticks/s", "GameState ticks/s", "speedup");
+	const bool randomOk = compare("random", randomPolicy);
+	const bool cycleOk = compare("cycle", cyclePolicy);
+	return randomOk && cycleOk ? 0 : 1;
+}
@@ -0,0 +1,72 @@
+/**
+	Helpers shared by the benchmarks: a stopwatch, a sink that keeps results from being optimized away,
+	and a Hamiltonian cycle used to grow snakes of any length without dying
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Vec2.h"
+#include <chrono>
+#include <cstdint>
+
+namespace Benchmark {
+
+	/**
+		Measures the time passed since construction / the last restart
+	*/
+	class Stopwatch {
+	public:
+		Stopwatch()
+			:
+			start(std::chrono::steady_clock::now())
+		{}
+		void restart()
+		{
+			start = std::chrono::steady_clock::now();
+		}
+		double getSeconds() const
+		{
+			return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+	private:
+		std::chrono::steady_clock::time_point start;
+	};
+
+	/**
+		Stores a value where the compiler can't prove it is unused
+	*/
+	inline void keep(std::uint64_t value)
+	{
+		static volatile std::uint64_t sink;
+		sink = sink + value;
+	}
+
+	/**
+		Returns the next tile of a Hamiltonian cycle over a width x height grid (width has to be even)
+		The cycle runs along the bottom row from left to right, so a freshly reset snake is already on it:
+		bottom row left to right, up the right-most column, then down / up the remaining columns from right to left
+
+		@param loc Current tile
+		@param width Grid width in tiles (even)
+		@param height Grid height in tiles
+		@return next tile of the cycle
+	*/
+	inline Vec2_<int> nextOnCycle(const Vec2_<int>& loc, int width, int height)
+	{
+		if (loc.y == height - 1) {
+			return loc.x == width - 1 ? Vec2_<int>(loc.x, loc.y - 1) : Vec2_<int>(loc.x + 1, loc.y);
+		}
+		if (loc.x == width - 1) {
+			return loc.y == 0 ? Vec2_<int>(loc.x - 1, 0) : Vec2_<int>(loc.x, loc.y - 1);
+		}
+		const bool goingDown = (width - 2 - loc.x) % 2 == 0;
+		if (goingDown) {
+			return loc.y == height - 2 ? (loc.x == 0 ? Vec2_<int>(0, height - 1) : Vec2_<int>(loc.x - 1, loc.y)) : Vec2_<int>(loc.x, loc.y + 1);
+		}
+		return loc.y == 0 ? Vec2_<int>(loc.x - 1, 0) : Vec2_<int>(loc.x, loc.y - 1);
+	}
+}
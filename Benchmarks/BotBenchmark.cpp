@@ -0,0 +1,70 @@
+/**
+	Plays games on the 20x11 board with each of the bots on one thread and reports
+	their mean score and the cost of a tick (the bot's decision plus the step)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include "MctsBot.h"
+#include <cstdio>
+#include <memory>
+
+static void measure(const char* name, Bot& bot, int games)
+{
+	GameState sim;
+	std::uint64_t ticks = 0;
+	std::int64_t score = 0;
+	int wins = 0;
+
+	Benchmark::Stopwatch watch;
+	for (int game = 0; game < games; ++game) {
+		sim.reset(game);
+		bot.reset(sim);
+		while (!sim.isGameOver()) {
+			sim.step(bot.act(sim));
+		}
+		ticks += sim.getTick();
+		score += sim.getScore();
+		wins += sim.isWon();
+	}
+	const double seconds = watch.getSeconds();
+
+	std::printf("%8s %12.1f %12.1f %8d %12.1f\n", name, double(score) / games, double(ticks) / games, wins, seconds * 1e9 / ticks);
+}
+
+int main()
+{
+	static constexpr int GAMES = 2000;
+	static constexpr int MCTS_GAMES = 5;
+
+	std::printf("%8s %12s %12s %8s %12s\n", "bot", "mean score", "ticks/game", "wins", "ns/tick");
+	RandomBot random(1, false);
+	RandomBot safe(1, true);
+	BfsBot bfs;
+	measure("random", random, GAMES);
+	measure("safe", safe, GAMES);
+	measure("bfs", bfs, GAMES);
+	HamiltonianBot hamilton;
+	measure("hamilton", hamilton, GAMES);
+
+	// Tree search is far slower per tick: a few games with a fixed number of playouts on one thread
+	MctsBot::Settings fixed;
+	fixed.threads = 1;
+	fixed.timeBudget = MctsBot::MAX_TIME_BUDGET;
+	fixed.maxIterations = 300;
+	MctsBot mcts(fixed);
+	measure("mcts", mcts, MCTS_GAMES);
+
+	// One move with the default settings (every core, time budget only) has to fit in the fastest move period
+	MctsBot timed;
+	GameState sim;
+	Benchmark::Stopwatch watch;
+	Benchmark::keep(std::uint64_t(timed.act(sim)));
+	std::printf("\nmcts move on every core: %.1f ms, fastest move period %.1f ms\n", watch.getSeconds() * 1e3, MctsBot::MAX_TIME_BUDGET * 1e3);
+	return 0;
+}
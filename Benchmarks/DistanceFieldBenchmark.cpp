@@ -0,0 +1,93 @@
+/**
+	Compares keeping the distance-to-food field up to date incrementally with searching it from scratch every tick
+	Games are steered by the field itself (the head takes the step towards the food it suggests, any safe move
+	when the food can't be reached), recorded, then replayed through both kinds of update
+	Every incremental field is checked against the full search before timing
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "DistanceField.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+	template<typename GridType>
+	SimulationBase::Action steer(const BasicSimulation<GridType>& sim, const BasicDistanceField<GridType>& field)
+	{
+		static const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };
+		const BasicSnake<GridType>& snek = sim.getSnake();
+		const Vec2_<int> head = snek.getHeadLocation();
+		const Vec2_<int> step = field.getStepToFood(head);
+		if (step != Vec2_<int>(DIR_ZERO)) {
+			return SimulationBase::toAction(step);
+		}
+		for (const Vec2_<int>& other : STEPS) {
+			if (other != -snek.getDirection() && sim.getGrid().isInside(head + other) && !snek.isInTile(head + other)) {
+				return SimulationBase::toAction(other);
+			}
+		}
+		return SimulationBase::Action::None;
+	}
+
+	template<typename GridType>
+	void measure(const char* name, int nStates)
+	{
+		const GridType grid;
+		BasicDistanceField<GridType> field(grid);
+		BasicDistanceField<GridType> reference(grid);
+		std::vector<BasicSimulation<GridType>> states;
+		states.reserve(nStates);
+
+		// Record games, checking the incremental field at every tick
+		BasicSimulation<GridType> sim(grid);
+		std::uint64_t rebuilds = 0;
+		for (std::uint64_t seed = 0; int(states.size()) < nStates; ++seed) {
+			sim.reset(seed);
+			field.update(sim);
+			while (!sim.isGameOver() && int(states.size()) < nStates) {
+				const std::uint64_t foodIndex = sim.getFood().getFoodIndex();
+				sim.step(steer(sim, field));
+				field.update(sim);
+				reference.rebuild(sim);
+				rebuilds += sim.getFood().getFoodIndex() != foodIndex;
+				for (int tile = 0; tile < grid.getCellCount(); ++tile) {
+					if (field.getDistance(grid.toLocation(tile)) != reference.getDistance(grid.toLocation(tile))) {
+						std::printf("%s: incremental field differs from the full search\n", name);
+						std::exit(1);
+					}
+				}
+				states.push_back(sim);
+			}
+		}
+
+		std::uint64_t sum = 0;
+		Benchmark::Stopwatch watch;
+		for (const BasicSimulation<GridType>& state : states) {
+			field.update(state);
+			sum += field.getDistance(state.getSnake().getTailLocation());
+		}
+		const double incremental = watch.getSeconds() * 1e9 / states.size();
+		watch.restart();
+		for (const BasicSimulation<GridType>& state : states) {
+			reference.rebuild(state);
+			sum += reference.getDistance(state.getSnake().getTailLocation());
+		}
+		const double full = watch.getSeconds() * 1e9 / states.size();
+		Benchmark::keep(sum);
+
+		std::printf("%10s %10d %10.1f%% %14.0f %14.0f %9.1fx\n", name, nStates, 100.0 * rebuilds / states.size(), incremental, full, full / incremental);
+	}
+}
+
+int main()
+{
+	std::printf("%10s %10s %11s %14s %14s %10s\n", "grid", "ticks", "respawns", "update ns", "rebuild ns", "speedup");
+	measure<ClassicGrid>("20x11", 200000);
+	measure<MediumGrid>("40x22", 50000);
+	measure<LargeGrid>("64x64", 20000);
+	return 0;
+}
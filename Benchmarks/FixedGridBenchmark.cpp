@@ -0,0 +1,85 @@
+/**
+	Compares the simulation compiled for a FixedGrid preset with the same grid size given at runtime (Grid)
+	Both snakes follow the same Hamiltonian cycle, so they run exactly the same ticks
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Simulation.h"
+#include <cstdio>
+
+/**
+	Runs a cycle-following game for a number of ticks (restarting whenever the board is full)
+
+	@return seconds per tick
+*/
+template<typename GridType>
+static double measureTicks(const GridType& grid, int ticks)
+{
+	BasicSimulation<GridType> sim(grid);
+	std::uint64_t checksum = 0;
+
+	Benchmark::Stopwatch watch;
+	for (int i = 0; i < ticks; ++i) {
+		if (sim.isGameOver()) {
+			checksum += sim.getScore();
+			sim.reset();
+		}
+		const Vec2_<int> head = sim.getSnake().getHeadLocation();
+		const Vec2_<int> next = Benchmark::nextOnCycle(head, grid.getWidth(), grid.getHeight());
+		sim.step(SimulationBase::toAction(next - head));
+	}
+	const double seconds = watch.getSeconds();
+	Benchmark::keep(checksum + sim.getScore());
+	return seconds / ticks;
+}
+
+/**
+	Queries every tile of the grid with isInTile
+
+	@return seconds per query
+*/
+template<typename GridType>
+static double measureQueries(const GridType& grid, int repeats)
+{
+	const BasicSnake<GridType> snek(grid);
+	std::uint64_t hits = 0;
+
+	Benchmark::Stopwatch watch;
+	for (int r = 0; r < repeats; ++r) {
+		for (int y = -1; y <= grid.getHeight(); ++y) {
+			for (int x = -1; x <= grid.getWidth(); ++x) {
+				hits += snek.isInTile({ x, y });
+			}
+		}
+	}
+	const double seconds = watch.getSeconds();
+	Benchmark::keep(hits);
+	return seconds / (double(repeats) * (grid.getWidth() + 2) * (grid.getHeight() + 2));
+}
+
+template<typename FixedGridType>
+static void compare(const char* name, int ticks, int repeats)
+{
+	const FixedGridType fixedGrid;
+	const Grid runtimeGrid(fixedGrid.getWidth(), fixedGrid.getHeight());
+
+	const double runtimeTick = measureTicks(runtimeGrid, ticks);
+	const double fixedTick = measureTicks(fixedGrid, ticks);
+	const double runtimeQuery = measureQueries(runtimeGrid, repeats);
+	const double fixedQuery = measureQueries(fixedGrid, repeats);
+
+	std::printf("%10s %-8s %14.2f %14.2f %10.2fx\n", name, "step", runtimeTick * 1e9, fixedTick * 1e9, runtimeTick / fixedTick);
+	std::printf("%10s %-8s %14.2f %14.2f %10.2fx\n", name, "isInTile", runtimeQuery * 1e9, fixedQuery * 1e9, runtimeQuery / fixedQuery);
+}
+
+int main()
+{
+	std::printf("%10s %-8s %14s %14s %11s\n", "grid", "", "Grid ns", "FixedGrid ns", "speedup");
+	compare<ClassicGrid>("20x11", 10000000, 20000);
+	compare<MediumGrid>("40x22", 10000000, 5000);
+	compare<LargeGrid>("64x64", 10000000, 1000);
+	return 0;
+}
@@ -0,0 +1,183 @@
+/**
+	Compares the bitboard flood fill with a breadth-first search visiting one Vec2_<int> tile at a time,
+	on the same positions: the reachable area from the head and whether the tail is reachable
+	Positions come from Hamiltonian bot games on the 20x11 and 64x64 grids (long, winding snakes) and from
+	random walls covering a third of the 256x256 grid. The two answers are checked against each other
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "FloodFill.h"
+#include "HamiltonianBot.h"
+#include "CounterRng.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+	template<typename GridType>
+	struct Position {
+		Bitboard<GridType::CELL_CAPACITY> blocked;
+		int head;
+		int tail;
+	};
+
+	/**
+		Breadth-first search over the tiles, with its buffers allocated once like the bots' searches
+	*/
+	template<typename GridType>
+	class NaiveSearch {
+	public:
+		NaiveSearch(const GridType& grid)
+			:
+			grid(grid),
+			queue(grid.getCellCount()),
+			visited(grid.getCellCount())
+		{}
+		int search(const Bitboard<GridType::CELL_CAPACITY>& blocked, int start, int target)	// Reached tile count, -1 once target is found
+		{
+			static const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };
+			std::fill(visited.begin(), visited.end(), false);
+			int front = 0;
+			int back = 0;
+			int count = 0;
+			queue[back++] = grid.toLocation(start);
+			visited[start] = true;
+			while (front < back) {
+				const Vec2_<int> tile = queue[front++];
+				for (const Vec2_<int>& step : STEPS) {
+					const Vec2_<int> next = tile + step;
+					if (!grid.isInside(next)) {
+						continue;
+					}
+					const int index = grid.toIndex(next);
+					if (index == target) {
+						return -1;
+					}
+					if (visited[index] || blocked.test(index)) {
+						continue;
+					}
+					visited[index] = true;
+					queue[back++] = next;
+					++count;
+				}
+			}
+			return count;
+		}
+
+	private:
+		GridType grid;
+		std::vector<Vec2_<int>> queue;
+		std::vector<bool> visited;
+	};
+
+	template<typename GridType>
+	std::vector<Position<GridType>> playPositions(int nPositions, std::uint64_t ticksBetween)
+	{
+		std::vector<Position<GridType>> positions;
+		BasicSimulation<GridType> sim;
+		BasicHamiltonianBot<GridType> bot;
+		for (std::uint64_t seed = 0; int(positions.size()) < nPositions; ++seed) {
+			sim.reset(seed);
+			bot.reset(sim);
+			while (!sim.isGameOver() && int(positions.size()) < nPositions) {
+				sim.step(bot.act(sim));
+				if (sim.getTick() % ticksBetween == 0) {
+					const BasicSnake<GridType>& snek = sim.getSnake();
+					const GridType& grid = sim.getGrid();
+					positions.push_back({ snek.getOccupancy(), grid.toIndex(snek.getHeadLocation()), grid.toIndex(snek.getTailLocation()) });
+				}
+			}
+		}
+		return positions;
+	}
+
+	template<typename GridType>
+	std::vector<Position<GridType>> randomPositions(int nPositions)
+	{
+		const GridType grid;
+		const CounterRng rng(1);
+		std::uint64_t counter = 0;
+		std::vector<Position<GridType>> positions;
+		for (int p = 0; p < nPositions; ++p) {
+			Bitboard<GridType::CELL_CAPACITY> blocked(grid.getCellCount());
+			for (int tile = 0; tile < grid.getCellCount(); ++tile) {
+				if (rng.below(counter++, 3) == 0) {
+					blocked.set(tile);
+				}
+			}
+			const int head = rng.below(counter++, grid.getCellCount());
+			const int tail = rng.below(counter++, grid.getCellCount());
+			blocked.set(head);
+			blocked.set(tail);
+			positions.push_back({ blocked, head, tail });
+		}
+		return positions;
+	}
+
+	template<typename GridType>
+	void measure(const char* name, const std::vector<Position<GridType>>& positions, int repeats)
+	{
+		const GridType grid;
+		BasicFloodFill<GridType> fill(grid);
+		NaiveSearch<GridType> naive(grid);
+
+		// Same answers
+		for (const Position<GridType>& position : positions) {
+			const int area = fill.countReachable(position.blocked, position.head);
+			const bool isTailReachable = fill.isReachable(position.blocked, position.head, position.tail);
+			if (area != naive.search(position.blocked, position.head, -1) ||
+				isTailReachable != (naive.search(position.blocked, position.head, position.tail) < 0)) {
+				std::printf("%s: flood fill and search disagree\n", name);
+				std::exit(1);
+			}
+		}
+
+		const double nQueries = double(positions.size()) * repeats;
+		std::uint64_t sum = 0;
+		Benchmark::Stopwatch watch;
+		for (int r = 0; r < repeats; ++r) {
+			for (const Position<GridType>& position : positions) {
+				sum += fill.countReachable(position.blocked, position.head);
+			}
+		}
+		const double fillArea = watch.getSeconds() * 1e9 / nQueries;
+		watch.restart();
+		for (int r = 0; r < repeats; ++r) {
+			for (const Position<GridType>& position : positions) {
+				sum += fill.isReachable(position.blocked, position.head, position.tail);
+			}
+		}
+		const double fillTail = watch.getSeconds() * 1e9 / nQueries;
+		watch.restart();
+		for (int r = 0; r < repeats; ++r) {
+			for (const Position<GridType>& position : positions) {
+				sum += naive.search(position.blocked, position.head, -1);
+			}
+		}
+		const double naiveArea = watch.getSeconds() * 1e9 / nQueries;
+		watch.restart();
+		for (int r = 0; r < repeats; ++r) {
+			for (const Position<GridType>& position : positions) {
+				sum += naive.search(position.blocked, position.head, position.tail) < 0;
+			}
+		}
+		const double naiveTail = watch.getSeconds() * 1e9 / nQueries;
+		Benchmark::keep(sum);
+
+		std::printf("%10s %12.0f %12.0f %12.0f %12.0f %8.1fx %8.1fx\n", name, fillArea, naiveArea, fillTail, naiveTail,
+			naiveArea / fillArea, naiveTail / fillTail);
+	}
+}
+
+int main()
+{
+	std::printf("%10s %12s %12s %12s %12s %9s %9s\n", "positions", "fill area", "bfs area", "fill tail", "bfs tail", "area", "tail");
+	std::printf("%10s %12s %12s %12s %12s %9s %9s\n", "", "ns", "ns", "ns", "ns", "speedup", "speedup");
+	measure("20x11", playPositions<ClassicGrid>(2000, 7), 100);
+	measure("64x64", playPositions<LargeGrid>(500, 4001), 10);
+	measure("256x256", randomPositions<HugeGrid>(50), 10);
+	return 0;
+}
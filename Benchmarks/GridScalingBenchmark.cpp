@@ -0,0 +1,46 @@
+/**
+	Measures the simulation on grids from the classic 20x11 up to 1024x1024
+	The snake follows a Hamiltonian cycle, so it never dies and keeps eating, and the cost per tick
+	should not depend on the size of the grid (only reset does work proportional to it)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Simulation.h"
+#include <cstdio>
+
+int main()
+{
+	static constexpr int SIZES[][2] = { { 20, 11 }, { 64, 64 }, { 256, 256 }, { 1024, 1024 } };
+	static constexpr int TICKS = 4000000;
+
+	std::printf("%12s %12s %12s %12s %10s\n", "grid", "alloc ms", "reset ms", "ns/tick", "length");
+	for (const auto& size : SIZES) {
+		const Grid grid(size[0], size[1]);
+
+		Benchmark::Stopwatch watch;
+		Simulation sim(grid);
+		const double allocSeconds = watch.getSeconds();
+
+		watch.restart();
+		sim.reset();
+		const double resetSeconds = watch.getSeconds();
+
+		watch.restart();
+		for (int i = 0; i < TICKS && !sim.isGameOver(); ++i) {
+			const Vec2_<int> head = sim.getSnake().getHeadLocation();
+			const Vec2_<int> next = Benchmark::nextOnCycle(head, grid.getWidth(), grid.getHeight());
+			sim.step(Simulation::toAction(next - head));
+		}
+		const double tickSeconds = watch.getSeconds();
+		Benchmark::keep(sim.getScore());
+
+		char name[32];
+		std::snprintf(name, sizeof(name), "%dx%d", size[0], size[1]);
+		std::printf("%12s %12.3f %12.3f %12.2f %10d%s\n", name, allocSeconds * 1e3, resetSeconds * 1e3,
+			tickSeconds * 1e9 / sim.getTick(), sim.getSnake().getLength(), sim.isWon() ? " (won)" : "");
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+/**
+	Compares reading the game hash kept up to date by the snake and the food with recomputing it every tick
+	The snake follows a Hamiltonian cycle, so it grows until it fills the board and the game restarts
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Simulation.h"
+#include <cstdio>
+
+/**
+	Plays a cycle-following game for a number of ticks, hashing the position after every one of them
+
+	@param recomputes true to hash with computeHash, false to read getHash
+	@return seconds per tick
+*/
+template<typename GridType>
+static double measure(bool recomputes, int ticks)
+{
+	const GridType grid;
+	BasicSimulation<GridType> sim(grid);
+	std::uint64_t checksum = 0;
+
+	Benchmark::Stopwatch watch;
+	for (int i = 0; i < ticks; ++i) {
+		if (sim.isGameOver()) {
+			sim.reset();
+		}
+		const Vec2_<int> head = sim.getSnake().getHeadLocation();
+		sim.step(SimulationBase::toAction(Benchmark::nextOnCycle(head, grid.getWidth(), grid.getHeight()) - head));
+		checksum ^= recomputes ? sim.computeHash() : sim.getHash();
+	}
+	const double seconds = watch.getSeconds();
+	Benchmark::keep(checksum);
+	return seconds / ticks;
+}
+
+template<typename GridType>
+static void compare(const char* name, int ticks)
+{
+	const double incremental = measure<GridType>(false, ticks);
+	const double recomputed = measure<GridType>(true, ticks);
+	std::printf("%10s %16.2f %16.2f %10.2fx\n", name, incremental * 1e9, recomputed * 1e9, recomputed / incremental);
+}
+
+int main()
+{
+	std::printf("%10s %16s %16s %11s\n", "grid", "getHash ns/tick", "recompute ns/tick", "speedup");
+	compare<ClassicGrid>("20x11", 10000000);
+	compare<MediumGrid>("40x22", 5000000);
+	compare<LargeGrid>("64x64", 2000000);
+	return 0;
+}
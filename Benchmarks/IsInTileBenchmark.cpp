@@ -0,0 +1,86 @@
+/**
+	Measures Snake::isInTile for snakes from the starting 9 segments up to a full board,
+	compared with walking the segments (how isInTile used to work)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Snake.h"
+#include <cstdio>
+#include <vector>
+
+/**
+	Grows the snake along the benchmark cycle until it has the requested length
+*/
+static void growTo(Snake& snek, int length)
+{
+	snek.reset();
+	while (snek.getLength() < length) {
+		const Vec2_<int> head = snek.getHeadLocation();
+		snek.grow();
+		snek.queueDirection(Benchmark::nextOnCycle(head, Grid::CLASSIC_WIDTH, Grid::CLASSIC_HEIGHT) - head);
+		snek.move();
+	}
+}
+
+/**
+	Reference implementation: linear scan over the segments
+*/
+static bool isInTileNaive(const Snake& snek, const Vec2_<int>& loc)
+{
+	for (const Vec2_<int>& segment : snek) {
+		if (segment == loc) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int main()
+{
+	static constexpr int LENGTHS[] = { 9, 25, 50, 100, 150, 200, Grid::CLASSIC_WIDTH * Grid::CLASSIC_HEIGHT };
+	static constexpr int REPEATS = 20000;
+
+	std::vector<Vec2_<int>> tiles;
+	for (int y = 0; y < Grid::CLASSIC_HEIGHT; ++y) {
+		for (int x = 0; x < Grid::CLASSIC_WIDTH; ++x) {
+			tiles.push_back({ x, y });
+		}
+	}
+
+	std::printf("%8s %16s %16s\n", "length", "bitboard ns/q", "naive ns/q");
+	for (int length : LENGTHS) {
+		Snake snek;
+		growTo(snek, length);
+
+		std::uint64_t hits = 0;
+		Benchmark::Stopwatch watch;
+		for (int r = 0; r < REPEATS; ++r) {
+			for (const Vec2_<int>& tile : tiles) {
+				hits += snek.isInTile(tile);
+			}
+		}
+		const double bitboardSeconds = watch.getSeconds();
+
+		std::uint64_t naiveHits = 0;
+		watch.restart();
+		for (int r = 0; r < REPEATS / 20; ++r) {
+			for (const Vec2_<int>& tile : tiles) {
+				naiveHits += isInTileNaive(snek, tile);
+			}
+		}
+		const double naiveSeconds = watch.getSeconds() * 20;
+
+		if (hits != naiveHits * 20 || hits != std::uint64_t(length) * REPEATS) {
+			std::printf("mismatch at length %d\n", length);
+			return 1;
+		}
+		Benchmark::keep(hits);
+
+		const double queries = double(REPEATS) * tiles.size();
+		std::printf("%8d %16.2f %16.2f\n", length, bitboardSeconds * 1e9 / queries, naiveSeconds * 1e9 / queries);
+	}
+	return 0;
+}
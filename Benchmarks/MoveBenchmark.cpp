@@ -0,0 +1,40 @@
+/**
+	Measures the cost of Snake::move for snakes from the starting 9 segments up to a full board
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Snake.h"
+#include <cstdio>
+
+int main()
+{
+	static constexpr int LENGTHS[] = { 9, 25, 50, 100, 150, 200, Grid::CLASSIC_WIDTH * Grid::CLASSIC_HEIGHT - 1 };
+	static constexpr int MOVES = 2000000;
+
+	std::printf("%8s %12s\n", "length", "ns/move");
+	for (int length : LENGTHS) {
+		Snake snek;
+		snek.reset();
+		while (snek.getLength() < length) {
+			const Vec2_<int> head = snek.getHeadLocation();
+			snek.grow();
+			snek.queueDirection(Benchmark::nextOnCycle(head, Grid::CLASSIC_WIDTH, Grid::CLASSIC_HEIGHT) - head);
+			snek.move();
+		}
+
+		Benchmark::Stopwatch watch;
+		for (int i = 0; i < MOVES; ++i) {
+			const Vec2_<int> head = snek.getHeadLocation();
+			snek.queueDirection(Benchmark::nextOnCycle(head, Grid::CLASSIC_WIDTH, Grid::CLASSIC_HEIGHT) - head);
+			snek.move();
+		}
+		const double seconds = watch.getSeconds();
+		Benchmark::keep(snek.getHeadLocation().x);
+
+		std::printf("%8d %12.2f\n", length, seconds * 1e9 / MOVES);
+	}
+	return 0;
+}
@@ -0,0 +1,75 @@
+/**
+	Measures the packed snake body against the ring buffer of locations (RingBody) on a 1024x1024 grid with snakes
+	of 10^3 to 10^6 segments: the bytes a copy of the snake's tiles takes (the body, sized for the whole grid, plus
+	the occupancy bitboard both bodies come with), the cost of such a copy, and the cost of visiting every segment
+	location with the iterators of the build's body (decoding them, for the packed one)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "Snake.h"
+#include <cstdio>
+
+/**
+	Returns the seconds a copy of a body and of the snake's occupancy takes, on average
+*/
+template<typename Body>
+static double measureCopy(const Body& body, const Snake& snek)
+{
+	static constexpr int COPIES = 20;
+	Benchmark::Stopwatch watch;
+	for (int i = 0; i < COPIES; ++i) {
+		const Body bodyCopy(body);
+		const Bitboard<DYNAMIC_CAPACITY> occupancyCopy(snek.getOccupancy());
+		Benchmark::keep(bodyCopy.back().x + int(occupancyCopy.test(0)));
+	}
+	return watch.getSeconds() / COPIES;
+}
+
+int main()
+{
+	static constexpr int SIZE = 1024;
+	static constexpr int LENGTHS[] = { 1000, 10000, 100000, 1000000 };
+
+	const Grid grid(SIZE, SIZE);
+	Snake snek(grid);
+
+	std::printf("%8s %12s %12s %8s %14s %14s %14s\n", "length", "packed KiB", "ring KiB", "ratio", "packed copy ms", "ring copy ms", "visit ns/seg");
+	for (int length : LENGTHS) {
+		while (snek.getLength() < length) {
+			const Vec2_<int> head = snek.getHeadLocation();
+			snek.grow();
+			snek.queueDirection(Benchmark::nextOnCycle(head, SIZE, SIZE) - head);
+			snek.move();
+		}
+
+		// The same snake in both representations
+		PackedBody<DYNAMIC_CAPACITY> packed(grid.getCellCount());
+		RingBody<DYNAMIC_CAPACITY> ring(grid.getCellCount());
+		packed.reset(snek.getHeadLocation());
+		ring.reset(snek.getHeadLocation());
+		for (auto segment = ++snek.begin(); segment != snek.end(); ++segment) {
+			packed.pushBack(*segment);
+			ring.pushBack(*segment);
+		}
+		const double occupancyBytes = double(snek.getOccupancy().getWordCount()) * sizeof(std::uint64_t);
+		const double packedBytes = double(packed.getWordCount()) * sizeof(std::uint64_t) + occupancyBytes;
+		const double ringBytes = double(grid.getCellCount()) * sizeof(Vec2_<int>) + occupancyBytes;
+		const double packedSeconds = measureCopy(packed, snek);
+		const double ringSeconds = measureCopy(ring, snek);
+
+		std::uint64_t checksum = 0;
+		Benchmark::Stopwatch watch;
+		for (const Vec2_<int>& segment : snek) {
+			checksum += segment.x * SIZE + segment.y;
+		}
+		const double visitSeconds = watch.getSeconds();
+		Benchmark::keep(checksum);
+
+		std::printf("%8d %12.0f %12.0f %7.1fx %14.3f %14.3f %14.2f\n", length, packedBytes / 1024, ringBytes / 1024,
+			ringBytes / packedBytes, packedSeconds * 1e3, ringSeconds * 1e3, visitSeconds * 1e9 / length);
+	}
+	return 0;
+}
@@ -0,0 +1,128 @@
+/**
+	Compares the entropy coded replay stream (ReplayCodec) with Replay's varint format: size and encode / decode speed,
+	in MB of varint replays per second. Games come from a replay file, or are played by the bfs, safe random and
+	Hamiltonian bots. Every decoded game is checked against the original
+
+	Usage: snek_bench_replay_codec [replay file]
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "ReplayCodec.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+	Plays games with a bot, recording the actions it queues to turn the snake like the replay tool does
+
+	@param replays Receives the games
+*/
+static void play(Bot& bot, int games, std::uint64_t seed, std::vector<Replay>& replays)
+{
+	static constexpr std::uint64_t MAX_TICKS = 1000000;
+	GameState sim;
+	const CounterRng seeds(seed);
+	for (int game = 0; game < games; ++game) {
+		sim.reset(seeds(game));
+		bot.reset(sim);
+		Replay replay;
+		replay.header = Replay::makeHeader(sim);
+		while (!sim.isGameOver() && sim.getTick() < MAX_TICKS) {
+			const SimulationBase::Action action = bot.act(sim);
+			if (action != SimulationBase::Action::None && SimulationBase::toDirection(action) != sim.getSnake().getDirection()) {
+				replay.events.push_back({ sim.getTick(), action, 0 });
+				sim.queueAction(action);
+			}
+			sim.step();
+		}
+		replay.finalTick = sim.getTick();
+		replay.finalScore = sim.getScore();
+		replay.isComplete = true;
+		replays.push_back(std::move(replay));
+	}
+}
+
+static void compare(const char* name, const std::vector<Replay>& replays)
+{
+	static constexpr int ROUNDS = 5;
+	std::vector<std::uint8_t> varint;
+	std::size_t actions = 0;
+	for (const Replay& replay : replays) {
+		replay.encode(varint);
+		actions += replay.events.size();
+	}
+
+	std::vector<std::uint8_t> packed;
+	Benchmark::Stopwatch watch;
+	for (int round = 0; round < ROUNDS; ++round) {
+		packed.clear();
+		ReplayEncoder encoder(packed);
+		for (const Replay& replay : replays) {
+			encoder.writeGame(replay);
+		}
+		encoder.finish();
+	}
+	const double encodeSeconds = watch.getSeconds() / ROUNDS;
+
+	watch.restart();
+	std::size_t decodedGames = 0;
+	for (int round = 0; round < ROUNDS; ++round) {
+		ReplayDecoder decoder(packed.data(), packed.size());
+		Replay replay;
+		while (decoder.readGame(replay)) {
+			Benchmark::keep(replay.finalTick);
+			++decodedGames;
+		}
+	}
+	const double decodeSeconds = watch.getSeconds() / ROUNDS;
+
+	std::vector<std::uint8_t> roundTrip;
+	for (const Replay& replay : ReplayDecoder::decode(packed.data(), packed.size())) {
+		replay.encode(roundTrip);
+	}
+	const bool matches = roundTrip == varint && decodedGames == replays.size() * ROUNDS;
+
+	const double megabytes = varint.size() / 1e6;
+	std::printf("%10s %7zu %10zu %10zu %7.2fx %9.2f %9.2f %10.1f %10.1f %s\n", name, replays.size(), varint.size(), packed.size(),
+		double(varint.size()) / packed.size(), packed.size() * 8.0 / replays.size(), (packed.size() * 8.0 - replays.size() * 64.0) / actions,
+		megabytes / encodeSeconds, megabytes / decodeSeconds, matches ? "ok" : "MISMATCH");
+}
+
+int main(int argc, char* argv[])
+{
+	std::printf("%10s %7s %10s %10s %8s %9s %9s %10s %10s\n", "games", "count", "varint B", "coded B", "ratio",
+		"bits/game", "bits/act", "enc MB/s", "dec MB/s");
+	try {
+		if (argc > 1) {
+			compare("file", Replay::load(argv[1]));
+			return 0;
+		}
+		std::vector<Replay> all;
+		const std::pair<const char*, std::unique_ptr<Bot>> bots[] = {
+			{ "bfs", std::unique_ptr<Bot>(new BfsBot()) },
+			{ "safe", std::unique_ptr<Bot>(new RandomBot(1, true)) },
+			{ "hamilton", std::unique_ptr<Bot>(new HamiltonianBot()) }
+		};
+		for (const auto& bot : bots) {
+			std::vector<Replay> replays;
+			play(*bot.second, bot.first == std::string("hamilton") ? 100 : 2000, 1, replays);
+			compare(bot.first, replays);
+			all.insert(all.end(), replays.begin(), replays.end());
+		}
+		compare("all", all);
+	}
+	catch (const std::runtime_error& e) {
+		std::fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
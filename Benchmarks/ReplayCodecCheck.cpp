@@ -0,0 +1,244 @@
+/**
+	Checks the entropy coded replay streams (ReplayCodec) end to end: games coded and decoded again are unchanged,
+	streams appended to each other (and the sessions of a packed ReplayRecorder) are read as one, and a stream cut
+	at any byte, at the end of the data or between two whole streams, keeps every game before the cut,
+	the cut game's records up to it and every game of the streams after it
+
+	Usage: snek_check_replay_codec
+	Exits with 1 if a check fails, run by ctest
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "ReplayCodec.h"
+#include "ReplayRecorder.h"
+#include "RandomBot.h"
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+	Makes up games with the records a stream can hold: several grid sizes, speed changes, long and short gaps,
+	games with and without an end record
+
+	@return games
+*/
+static std::vector<Replay> makeGames(int games, std::uint64_t seed)
+{
+	const CounterRng rng(seed);
+	std::uint64_t counter = 0;
+	std::vector<Replay> replays(games);
+	for (Replay& replay : replays) {
+		replay.header.width = std::uint16_t(rng.below(counter++, 3) == 0 ? 40 : Grid::CLASSIC_WIDTH);
+		replay.header.height = std::uint16_t(rng.below(counter++, 3) == 0 ? 22 : Grid::CLASSIC_HEIGHT);
+		replay.header.speedLevel = std::uint8_t(1 + rng.below(counter++, 9));
+		replay.header.seed = rng(counter++);
+		std::uint64_t tick = 0;
+		const int nEvents = rng.below(counter++, 200);
+		for (int e = 0; e < nEvents; ++e) {
+			tick += rng.below(counter++, 8) == 0 ? std::uint64_t(rng.below(counter++, 1 << 20)) : std::uint64_t(rng.below(counter++, 12));
+			if (rng.below(counter++, 20) == 0) {
+				replay.events.push_back({ tick, SimulationBase::Action::None, std::uint8_t(1 + rng.below(counter++, 9)) });
+			}
+			else {
+				replay.events.push_back({ tick, SimulationBase::Action(1 + rng.below(counter++, 4)), 0 });
+			}
+		}
+		replay.isComplete = rng.below(counter++, 8) != 0;
+		replay.finalTick = replay.isComplete ? tick + rng.below(counter++, 100) : tick;
+		replay.finalScore = replay.isComplete ? rng.below(counter++, 5000) : 0;
+	}
+	return replays;
+}
+
+static bool isSameHeader(const Replay& a, const Replay& b)
+{
+	return a.header.width == b.header.width && a.header.height == b.header.height
+		&& a.header.speedLevel == b.header.speedLevel && a.header.seed == b.header.seed;
+}
+
+static bool isSameEvent(const Replay::Event& a, const Replay::Event& b)
+{
+	return a.tick == b.tick && a.action == b.action && a.speedLevel == b.speedLevel;
+}
+
+static bool isSame(const Replay& a, const Replay& b)
+{
+	if (!isSameHeader(a, b) || a.events.size() != b.events.size() || a.isComplete != b.isComplete || a.finalTick != b.finalTick
+		|| a.finalScore != b.finalScore) {
+		return false;
+	}
+	for (std::size_t e = 0; e < a.events.size(); ++e) {
+		if (!isSameEvent(a.events[e], b.events[e])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+	States whether or not a game read up to a cut is the start of the original game
+
+	@param cut Game decoded from a stream cut short
+	@param original Game that was coded
+	@return bool
+*/
+static bool isCutOf(const Replay& cut, const Replay& original)
+{
+	if (!isSameHeader(cut, original) || cut.isComplete || cut.events.size() > original.events.size()) {
+		return false;
+	}
+	for (std::size_t e = 0; e < cut.events.size(); ++e) {
+		if (!isSameEvent(cut.events[e], original.events[e])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+static std::vector<std::uint8_t> encode(const std::vector<Replay>& replays)
+{
+	std::vector<std::uint8_t> packed;
+	ReplayEncoder encoder(packed);
+	for (const Replay& replay : replays) {
+		encoder.writeGame(replay);
+	}
+	encoder.finish();
+	return packed;
+}
+
+/**
+	Checks decoded games against the coded ones, stream by stream
+
+	@param decoded Games read from the streams
+	@param streams Games coded in each stream
+	@param cutStream Index of the stream cut short, whose games may end with a game read up to the cut, -1 if none
+	@return bool true if every game is where it should be
+*/
+static bool matches(const std::vector<Replay>& decoded, const std::vector<std::vector<Replay>>& streams, int cutStream)
+{
+	std::size_t next = 0;
+	for (int s = 0; s < int(streams.size()); ++s) {
+		for (const Replay& original : streams[s]) {
+			if (next < decoded.size() && isSame(decoded[next], original)) {
+				++next;
+			}
+			else {
+				if (s == cutStream && next < decoded.size() && isCutOf(decoded[next], original)) {
+					++next;
+				}
+				if (s != cutStream) {
+					return false;
+				}
+				break;	// The rest of the cut stream is lost
+			}
+		}
+	}
+	return next == decoded.size();
+}
+
+static bool report(const char* name, bool isOk)
+{
+	std::printf("%-34s %s\n", name, isOk ? "ok" : "FAILED");
+	return isOk;
+}
+
+/**
+	Plays two sessions of games with a packed ReplayRecorder appending to the same file
+
+	@param path File, replaced
+	@param played Receives the games as they were played
+*/
+static void record(const std::string& path, std::vector<Replay>& played)
+{
+	std::remove(path.c_str());
+	RandomBot bot(1, true);
+	GameState sim;
+	for (int session = 0; session < 2; ++session) {
+		ReplayRecorder recorder(path, true, ReplayRecorder::Format::Packed);
+		if (!recorder.isOpen()) {
+			throw std::runtime_error("Can't open " + path);
+		}
+		for (int game = 0; game < 20; ++game) {
+			sim.reset(std::uint64_t(session * 100 + game));
+			bot.reset(sim);
+			recorder.beginGame(sim);
+			Replay replay;
+			replay.header = Replay::makeHeader(sim);
+			while (!sim.isGameOver()) {
+				const SimulationBase::Action action = bot.act(sim);
+				if (action != SimulationBase::Action::None && SimulationBase::toDirection(action) != sim.getSnake().getDirection()) {
+					recorder.recordAction(sim.getTick(), action);
+					replay.events.push_back({ sim.getTick(), action, 0 });
+					sim.queueAction(action);
+				}
+				sim.step();
+			}
+			recorder.endGame(sim.getTick(), sim.getScore());
+			replay.finalTick = sim.getTick();
+			replay.finalScore = sim.getScore();
+			replay.isComplete = true;
+			played.push_back(std::move(replay));
+		}
+	}
+}
+
+int main()
+{
+	try {
+		bool isOk = true;
+		const std::vector<Replay> games = makeGames(300, 1);
+		const std::vector<std::uint8_t> whole = encode(games);
+		std::size_t damaged = 1;
+		isOk &= report("round trip", matches(ReplayDecoder::decode(whole.data(), whole.size(), &damaged), { games }, -1) && damaged == 0);
+
+		// Three streams, the middle one without games
+		const std::vector<std::vector<Replay>> streams = { makeGames(12, 2), {}, makeGames(12, 3) };
+		std::vector<std::vector<std::uint8_t>> packed;
+		std::vector<std::uint8_t> appended;
+		for (const std::vector<Replay>& stream : streams) {
+			packed.push_back(encode(stream));
+			appended.insert(appended.end(), packed.back().begin(), packed.back().end());
+		}
+		isOk &= report("appended streams", matches(ReplayDecoder::decode(appended.data(), appended.size(), &damaged), streams, -1) && damaged == 0);
+
+		const std::string path = "replay_codec_check.snekz";
+		std::vector<Replay> played;
+		record(path, played);
+		const std::vector<Replay> loaded = ReplayDecoder::load(path, &damaged);
+		bool isPlayedBack = matches(loaded, { played }, -1) && damaged == 0;
+		Simulation sim;
+		for (const Replay& replay : loaded) {
+			replay.play(sim);
+			isPlayedBack &= replay.matches(sim);
+		}
+		std::remove(path.c_str());
+		isOk &= report("recorder sessions", isPlayedBack);
+
+		// The first stream, then the last one cut at every byte
+		bool isCutOk = true;
+		for (std::size_t cut = 0; cut < packed[2].size(); ++cut) {
+			std::vector<std::uint8_t> data(packed[0]);
+			data.insert(data.end(), packed[2].begin(), packed[2].begin() + cut);
+			isCutOk &= matches(ReplayDecoder::decode(data.data(), data.size(), &damaged), { streams[0], streams[2] }, 1);
+			isCutOk &= damaged == (cut >= ReplayCodec::MAGIC_SIZE ? 1u : 0u);	// A few bytes of the magic aren't a stream
+		}
+		isOk &= report("truncated final stream", isCutOk);
+
+		// The first stream cut at every byte, then the last one whole
+		isCutOk = true;
+		for (std::size_t cut = ReplayCodec::MAGIC_SIZE; cut < packed[0].size(); ++cut) {	// Shorter data doesn't start with a stream
+			std::vector<std::uint8_t> data(packed[0].begin(), packed[0].begin() + cut);
+			data.insert(data.end(), packed[2].begin(), packed[2].end());
+			isCutOk &= matches(ReplayDecoder::decode(data.data(), data.size(), &damaged), { streams[0], streams[2] }, 0) && damaged == 1;
+		}
+		isOk &= report("truncated stream before another", isCutOk);
+		return isOk ? 0 : 1;
+	}
+	catch (const std::runtime_error& e) {
+		std::fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,96 @@
+/**
+	Records one long game into a seekable replay, then seeks to random ticks in it and reports how long a seek takes
+	The snake follows a Hamiltonian cycle on a 64x64 grid until it fills the board, a game of about 4 million ticks;
+	a keyframe is 18 KB (the food's free tiles take 16 KB of it), so with one every 64 ticks the file is about 1.2 GB.
+	Seeks are checked against hashes taken while recording
+
+	Usage: snek_bench_seek [file] [keyframe interval] [seeks]
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "SeekableRecorder.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	const std::string path = argc > 1 ? argv[1] : "seek_benchmark.snks";
+	const std::uint32_t interval = argc > 2 ? std::uint32_t(std::atoi(argv[2])) : 64;
+	const int seeks = argc > 3 ? std::atoi(argv[3]) : 100000;
+	static constexpr std::uint64_t CHECK_EVERY = 9973;	// Ticks between hashes kept for checking seeks
+
+	try {
+		const LargeGrid grid;
+		BasicSimulation<LargeGrid> sim(grid);
+		sim.reset(1);
+		std::vector<std::pair<std::uint64_t, std::uint64_t>> checks;	// Tick and hash
+
+		Benchmark::Stopwatch watch;
+		{
+			BasicSeekableRecorder<LargeGrid> recorder(path, sim, interval);
+			while (!sim.isGameOver()) {
+				recorder.recordTick(sim);
+				if (sim.getTick() % CHECK_EVERY == 0) {
+					checks.emplace_back(sim.getTick(), sim.getHash());
+				}
+				const Vec2_<int> head = sim.getSnake().getHeadLocation();
+				const Vec2_<int> dir = Benchmark::nextOnCycle(head, grid.getWidth(), grid.getHeight()) - head;
+				if (dir != sim.getSnake().getDirection()) {
+					recorder.recordAction(sim.getTick(), SimulationBase::toAction(dir));
+					sim.queueAction(SimulationBase::toAction(dir));
+				}
+				sim.step();
+			}
+			recorder.finish(sim.getTick(), sim.getScore());
+		}
+		const double recordSeconds = watch.getSeconds();
+
+		watch.restart();
+		const BasicSeekableReplay<LargeGrid> replay(path);
+		const double openSeconds = watch.getSeconds();
+		std::printf("ticks:          %llu\n", static_cast<unsigned long long>(replay.getFinalTick()));
+		std::printf("keyframes:      %zu (every %u ticks)\n", replay.getKeyframeCount(), interval);
+		std::printf("file size:      %.1f MB\n", replay.getSize() / 1e6);
+		std::printf("record:         %.2f s\n", recordSeconds);
+		std::printf("open:           %.1f us\n", openSeconds * 1e6);
+
+		const CounterRng targets(7);
+		BasicSimulation<LargeGrid> seeked(grid);
+		std::vector<double> times(std::size_t(std::max(seeks, 1)), 0.0);
+		watch.restart();
+		for (int i = 0; i < seeks; ++i) {
+			Benchmark::Stopwatch seekWatch;
+			replay.seek(std::uint64_t(targets.below(std::uint64_t(i), int(replay.getFinalTick() + 1))), seeked);
+			times[i] = seekWatch.getSeconds();
+			Benchmark::keep(seeked.getHash());
+		}
+		const double seekSeconds = watch.getSeconds();
+		std::sort(times.begin(), times.end());
+		std::printf("seek (random):  %.2f us mean, %.2f us median, %.1f us at 99.9%%, %.1f us worst over %d seeks\n",
+			seekSeconds / std::max(seeks, 1) * 1e6, times[times.size() / 2] * 1e6, times[times.size() * 999 / 1000] * 1e6,
+			times.back() * 1e6, seeks);
+
+		int mismatches = 0;
+		for (const auto& check : checks) {
+			replay.seek(check.first, seeked);
+			mismatches += seeked.getTick() != check.first || seeked.getHash() != check.second;
+		}
+		replay.seek(replay.getFinalTick(), seeked);
+		mismatches += seeked.getScore() != replay.getFinalScore();
+		std::printf("checked seeks:  %zu, %d mismatches\n", checks.size() + 1, mismatches);
+		return mismatches == 0 ? 0 : 1;
+	}
+	catch (const std::runtime_error& e) {
+		std::fprintf(stderr, "%s\n", e.what());
+		return 1;
+	}
+}
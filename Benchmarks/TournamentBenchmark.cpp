@@ -0,0 +1,54 @@
+/**
+	Measures how the tournament runner scales with the number of threads, from 1 up to the hardware threads (at most 64)
+
+	Usage: snek_bench_tournament [max threads]
+	Uses the collision avoiding random bot, whose games last from a few to thousands of ticks,
+	and checks that every thread count gives the same results
+	Speedup is only meaningful up to the number of cores: rows with more threads than hardware threads are marked
+	with a *, their threads share cores and the efficiency there only shows the scheduler's overhead.
+	steals is the number of ranges the scheduler moved between threads
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Tournament.h"
+#include "RandomBot.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+int main(int argc, char* argv[])
+{
+	const int hardwareThreads = std::max(1, int(std::thread::hardware_concurrency()));
+	const int maxThreads = argc > 1 ? std::max(1, std::atoi(argv[1])) : std::min(64, hardwareThreads);
+
+	Tournament::Settings settings;
+	settings.episodes = 20000;
+	const Tournament::BotFactory makeBot = [&settings]() {
+		return std::unique_ptr<Bot>(new RandomBot(settings.seed, true));
+	};
+
+	std::printf("hardware threads: %d\n", hardwareThreads);
+	std::printf("%8s %14s %14s %10s %12s %8s\n", "threads", "episodes/s", "ticks/s", "speedup", "efficiency", "steals");
+	double singleRate = 0.0;
+	std::uint64_t expectedTicks = 0;
+	for (int threads = 1; threads <= maxThreads; threads = threads < maxThreads ? std::min(threads * 2, maxThreads) : threads + 1) {
+		settings.threads = threads;
+		const Tournament::Results results = Tournament().run(makeBot, settings);
+		const double rate = results.ticks / results.seconds;
+		if (threads == 1) {
+			singleRate = rate;
+			expectedTicks = results.ticks;
+		}
+		else if (results.ticks != expectedTicks) {
+			std::printf("results differ with %d threads\n", threads);
+			return 1;
+		}
+		std::printf("%7d%c %14.0f %14.3e %9.2fx %11.0f%% %8llu\n", threads, threads > hardwareThreads ? '*' : ' ',
+			results.episodes / results.seconds, rate, rate / singleRate, 100.0 * rate / singleRate / threads,
+			(unsigned long long)results.steals);
+	}
+	return 0;
+}
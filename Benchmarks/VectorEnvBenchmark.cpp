@@ -0,0 +1,56 @@
+/**
+	Measures the vectorized environment on the 20x11 board in env-steps per second on one core
+	Agents play random actions (a new one on every step, like an untrained policy), so episodes are short
+	and the automatic resets are part of the measurement
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Benchmark.h"
+#include "VectorEnv.h"
+#include <cstdio>
+#include <vector>
+
+int main()
+{
+	static constexpr int ENVS[] = { 64, 256, 1024, 4096 };
+	static constexpr int ACTION_TABLE = 257;	// Steps of precomputed actions, cycled through (prime, so envs don't line up)
+	static constexpr std::uint64_t STEPS_PER_SIZE = 40000000;
+
+	std::printf("%8s %16s %12s %12s\n", "envs", "env-steps/s", "episodes", "mean reward");
+	for (int nEnvs : ENVS) {
+		VectorEnv env(nEnvs);
+		std::vector<VectorEnv::Observation> observations(nEnvs);
+		std::vector<float> rewards(nEnvs);
+		std::vector<std::uint8_t> dones(nEnvs);
+		std::vector<std::uint64_t> seeds(nEnvs);
+		std::vector<VectorEnv::Action> actions(std::size_t(nEnvs) * ACTION_TABLE);
+		const CounterRng rng(7);
+		for (std::size_t i = 0; i < actions.size(); ++i) {
+			actions[i] = VectorEnv::Action(1 + rng.below(i, 4));
+		}
+		for (int i = 0; i < nEnvs; ++i) {
+			seeds[i] = i;
+		}
+
+		env.reset(seeds.data(), observations.data());
+		const std::uint64_t steps = STEPS_PER_SIZE / nEnvs;
+		std::uint64_t episodes = 0;
+		double totalReward = 0.0;
+		Benchmark::Stopwatch watch;
+		for (std::uint64_t s = 0; s < steps; ++s) {
+			env.step(&actions[std::size_t(s % ACTION_TABLE) * nEnvs], observations.data(), rewards.data(), dones.data());
+			for (int i = 0; i < nEnvs; ++i) {
+				episodes += dones[i] != VectorEnv::Running;
+				totalReward += rewards[i];
+			}
+		}
+		const double seconds = watch.getSeconds();
+		Benchmark::keep(observations[0].head);
+
+		std::printf("%8d %16.3e %12llu %12.3f\n", nEnvs, steps * nEnvs / seconds, (unsigned long long)episodes,
+			episodes > 0 ? totalReward / episodes : 0.0);
+	}
+	return 0;
+}
@@ -0,0 +1,372 @@
+#include "BatchSimulation.h"
+#include <algorithm>
+#include <iterator>
+#include <assert.h>
+
+namespace {
+	constexpr std::int32_t IDLE = -1;	// Values of nextTile besides tile indices
+	constexpr std::int32_t WALL = -2;
+	constexpr std::int32_t OVER = -3;
+	constexpr std::int32_t RUNNING = 0;
+
+	/**
+		Applies the actions to the directions and finds the tile every game's head moves to (or IDLE / WALL / OVER)
+		Has no branches and the arrays never overlap (__restrict, understood by GCC, Clang and MSVC), so the loop is vectorized
+	*/
+	void planMoves(int nGames, std::int32_t width, std::int32_t height, const SimulationBase::Action* __restrict actions,
+		const std::int32_t* __restrict state, const std::int32_t* __restrict headX, const std::int32_t* __restrict headY,
+		std::int32_t* __restrict dirX, std::int32_t* __restrict dirY, std::int32_t* __restrict nextTile)
+	{
+		using Action = SimulationBase::Action;
+		for (int i = 0; i < nGames; ++i) {
+			const std::int32_t action = std::int32_t(actions[i]);
+			const std::int32_t ax = std::int32_t(action == std::int32_t(Action::Right)) - std::int32_t(action == std::int32_t(Action::Left));
+			const std::int32_t ay = std::int32_t(action == std::int32_t(Action::Down)) - std::int32_t(action == std::int32_t(Action::Up));
+			const bool running = state[i] == RUNNING;
+			const bool turns = running & (action != std::int32_t(Action::None)) & ((ax != -dirX[i]) | (ay != -dirY[i]));	// Snake can't turn back into itself
+			const std::int32_t newX = turns ? ax : dirX[i];
+			const std::int32_t newY = turns ? ay : dirY[i];
+			dirX[i] = newX;
+			dirY[i] = newY;
+
+			const std::int32_t x = headX[i] + newX;
+			const std::int32_t y = headY[i] + newY;
+			const bool inside = (std::uint32_t(x) < std::uint32_t(width)) & (std::uint32_t(y) < std::uint32_t(height));
+			const bool idle = (newX | newY) == 0;
+			const std::int32_t moveTile = inside ? y * width + x : WALL;
+			nextTile[i] = !running ? OVER : (idle ? IDLE : moveTile);
+		}
+	}
+}
+
+/**
+	Constructs the batch and resets game i with seed i
+	All memory is allocated here, so steps and resets don't allocate
+
+	@param nGames Number of games played side by side
+	@param speedLevel Speed level of every snake (1-9), which is the score for a food
+	@param grid Grid all of the games are played on
+*/
+template<typename GridType>
+BasicBatchSimulation<GridType>::BasicBatchSimulation(int nGames, int speedLevel, const GridType& grid)
+	:
+	grid(grid),
+	nGames(nGames),
+	startOccupancy(grid.getCellCount()),
+	startFreeTiles(BasicFood<GridType>::usesFreeTiles(grid) ? grid.getCellCount() : 0),
+	headX(nGames),
+	headY(nGames),
+	dirX(nGames),
+	dirY(nGames),
+	state(nGames),
+	nextTile(nGames),
+	links(std::size_t(nGames) * LINK_WORDS),
+	linkFirst(nGames),
+	linkCount(nGames),
+	tailTile(nGames),
+	occupancies(nGames, Bitboard<GridType::CELL_CAPACITY>(grid.getCellCount())),
+	freeTiles(nGames, startFreeTiles),
+	foodTile(nGames),
+	rngs(nGames),
+	foodIndices(nGames),
+	scores(nGames),
+	ticks(nGames),
+	outcomes(nGames)
+{
+	assert(nGames > 0);
+	BasicSnake<GridType> snek(grid);
+	snek.setSpeed(speedLevel);
+	scorePerFood = snek.getSpeed();
+
+	// Link i joins segment i + 1 to segment i and is stored in slot i
+	std::fill(std::begin(startLinks), std::end(startLinks), 0);
+	startLinkCount = 0;
+	Vec2_<int> previous = snek.getHeadLocation();
+	for (auto segment = ++snek.begin(); segment != snek.end(); ++segment) {
+		const int code = PackedBody<GridType::CELL_CAPACITY>::encode(previous - *segment);
+		startLinks[startLinkCount >> 5] |= std::uint64_t(code) << ((startLinkCount & 31) * 2);
+		++startLinkCount;
+		previous = *segment;
+	}
+	startHead = snek.getHeadLocation();
+	startTail = grid.toIndex(snek.getTailLocation());
+	startOccupancy = snek.getOccupancy();
+	startFreeTiles.fill();		// Same as BasicFood::reset, the members have to be in the same order
+	for (const Vec2_<int>& segment : snek) {
+		startFreeTiles.erase(grid.toIndex(segment));
+	}
+	startFood = { grid.getWidth() / 2, grid.getHeight() / 2 };	// Same as BasicFood::reset
+	isStartFoodCovered = snek.isInTile(startFood);
+
+	for (int game = 0; game < nGames; ++game) {
+		reset(game, game);
+	}
+}
+
+/**
+	Puts one game back into its starting position, the same as BasicSimulation::reset(seed)
+
+	@param game Index of the game
+	@param seed Seed of the game's food placement
+*/
+template<typename GridType>
+void BasicBatchSimulation<GridType>::reset(int game, std::uint64_t seed)
+{
+	assert(game >= 0 && game < nGames);
+	std::copy(std::begin(startLinks), std::end(startLinks), links.begin() + std::size_t(game) * LINK_WORDS);
+	linkFirst[game] = 0;
+	linkCount[game] = startLinkCount;
+	tailTile[game] = startTail;
+	occupancies[game] = startOccupancy;
+	freeTiles[game] = startFreeTiles;
+	headX[game] = startHead.x;
+	headY[game] = startHead.y;
+	dirX[game] = 0;
+	dirY[game] = 0;
+	rngs[game] = CounterRng(seed);
+	if (isStartFoodCovered) {
+		foodTile[game] = BasicFood<GridType>::pickTile(grid, startOccupancy, startFreeTiles, grid.getCellCount() - startLinkCount - 1, rngs[game], 0);
+		foodIndices[game] = 1;
+	}
+	else {
+		foodTile[game] = grid.toIndex(startFood);
+		foodIndices[game] = 0;
+	}
+	state[game] = Running;
+	scores[game] = 0;
+	ticks[game] = 0;
+	outcomes[game] = Outcome::Idle;
+}
+
+/**
+	Resets every game
+
+	@param seeds One seed per game
+*/
+template<typename GridType>
+void BasicBatchSimulation<GridType>::resetAll(const std::uint64_t* seeds)
+{
+	for (int game = 0; game < nGames; ++game) {
+		reset(game, seeds[game]);
+	}
+}
+
+/**
+	Advances every game by one tick, like BasicSimulation::step(action) does for one game
+	Games which are over are left as they are, reset them to play again
+
+	@param actions One action per game, Action::None keeps the current direction
+	@return number of games still running after the step
+*/
+template<typename GridType>
+int BasicBatchSimulation<GridType>::step(const Action* actions)
+{
+	planMoves(nGames, grid.getWidth(), grid.getHeight(), actions, state.data(), headX.data(), headY.data(),
+		dirX.data(), dirY.data(), nextTile.data());
+
+	// Collisions with the body, moves, and respawns for the games that ate
+	const int cellCount = grid.getCellCount();
+	const std::int32_t tileStep[4] = { 1, grid.getWidth(), -1, -grid.getWidth() };	// Tile index change for each link code
+	const auto wrapSlot = [cellCount](int slot) { return slot >= cellCount ? slot - cellCount : slot; };
+	int nRunning = 0;
+	for (int i = 0; i < nGames; ++i) {
+		const std::int32_t tile = nextTile[i];
+		if (tile == OVER) {
+			continue;	// Outcome of the last step stays
+		}
+		++ticks[i];
+		if (tile == IDLE) {
+			outcomes[i] = Outcome::Idle;
+			++nRunning;
+			continue;
+		}
+		if (tile == WALL || occupancies[i].test(tile)) {
+			state[i] = Died;
+			outcomes[i] = Outcome::Died;
+			continue;
+		}
+
+		const bool eats = tile == foodTile[i];
+		std::uint64_t* const words = &links[std::size_t(i) * LINK_WORDS];
+		if (!eats) {	// Drop the tail: it moves along the last link
+			occupancies[i].reset(tailTile[i]);
+			freeTiles[i].insert(tailTile[i]);
+			const int slot = wrapSlot(linkFirst[i] + --linkCount[i]);
+			tailTile[i] += tileStep[(words[slot >> 5] >> ((slot & 31) * 2)) & 3];
+		}
+		const int slot = linkFirst[i] == 0 ? cellCount - 1 : linkFirst[i] - 1;	// New link behind the new head
+		const int shift = (slot & 31) * 2;
+		const std::uint64_t code = std::uint64_t(PackedBody<GridType::CELL_CAPACITY>::encode({ dirX[i], dirY[i] }));
+		words[slot >> 5] = (words[slot >> 5] & ~(std::uint64_t(3) << shift)) | (code << shift);
+		linkFirst[i] = slot;
+		++linkCount[i];
+		occupancies[i].set(tile);
+		freeTiles[i].erase(tile);
+		headX[i] += dirX[i];
+		headY[i] += dirY[i];
+
+		if (!eats) {
+			outcomes[i] = Outcome::Moved;
+			++nRunning;
+			continue;
+		}
+		scores[i] += scorePerFood;
+		const int nFree = cellCount - linkCount[i] - 1;
+		if (nFree == 0) {
+			state[i] = Won;
+			outcomes[i] = Outcome::Won;
+			continue;
+		}
+		foodTile[i] = BasicFood<GridType>::pickTile(grid, occupancies[i], freeTiles[i], nFree, rngs[i], foodIndices[i]++);
+		outcomes[i] = Outcome::Ate;
+		++nRunning;
+	}
+	return nRunning;
+}
+
+/**
+	Returns the number of games in the batch
+
+	@return number of games
+*/
+template<typename GridType>
+int BasicBatchSimulation<GridType>::getGameCount() const
+{
+	return nGames;
+}
+
+/**
+	Returns what happened to a game during the last step
+
+	@param game Index of the game
+	@return Outcome, Outcome::Idle right after a reset
+*/
+template<typename GridType>
+SimulationBase::Outcome BasicBatchSimulation<GridType>::getOutcome(int game) const
+{
+	return outcomes[game];
+}
+
+/**
+	States whether or not a game has ended, because the snake died or filled the board
+
+	@param game Index of the game
+	@return bool
+*/
+template<typename GridType>
+bool BasicBatchSimulation<GridType>::isGameOver(int game) const
+{
+	return state[game] != Running;
+}
+
+/**
+	States whether or not the snake of a game has filled the whole board
+
+	@param game Index of the game
+	@return bool
+*/
+template<typename GridType>
+bool BasicBatchSimulation<GridType>::isWon(int game) const
+{
+	return state[game] == Won;
+}
+
+/**
+	Returns the score of a game
+
+	@param game Index of the game
+	@return score
+*/
+template<typename GridType>
+int BasicBatchSimulation<GridType>::getScore(int game) const
+{
+	return scores[game];
+}
+
+/**
+	Returns the number of segments of a game's snake
+
+	@param game Index of the game
+	@return length
+*/
+template<typename GridType>
+int BasicBatchSimulation<GridType>::getLength(int game) const
+{
+	return linkCount[game] + 1;
+}
+
+/**
+	Returns the number of steps a game has taken since its last reset
+
+	@param game Index of the game
+	@return tick
+*/
+template<typename GridType>
+std::uint64_t BasicBatchSimulation<GridType>::getTick(int game) const
+{
+	return ticks[game];
+}
+
+/**
+	Returns the location of the head of a game's snake
+
+	@param game Index of the game
+	@return location in Tile units
+*/
+template<typename GridType>
+Vec2_<int> BasicBatchSimulation<GridType>::getHeadLocation(int game) const
+{
+	return { headX[game], headY[game] };
+}
+
+/**
+	Returns the direction of a game's snake
+
+	@param game Index of the game
+	@return direction, DIR_ZERO until the snake is given its first direction
+*/
+template<typename GridType>
+Vec2_<int> BasicBatchSimulation<GridType>::getDirection(int game) const
+{
+	return { dirX[game], dirY[game] };
+}
+
+/**
+	Returns the location of a game's food
+
+	@param game Index of the game
+	@return location in Tile units
+*/
+template<typename GridType>
+Vec2_<int> BasicBatchSimulation<GridType>::getFoodLocation(int game) const
+{
+	return grid.toLocation(foodTile[game]);
+}
+
+/**
+	Returns the tiles covered by a game's snake
+
+	@param game Index of the game
+	@return occupancy
+*/
+template<typename GridType>
+const Bitboard<GridType::CELL_CAPACITY>& BasicBatchSimulation<GridType>::getOccupancy(int game) const
+{
+	return occupancies[game];
+}
+
+/**
+	Returns the grid the games are played on
+
+	@return grid
+*/
+template<typename GridType>
+const GridType & BasicBatchSimulation<GridType>::getGrid() const
+{
+	return grid;
+}
+
+template class BasicBatchSimulation<ClassicGrid>;
+template class BasicBatchSimulation<MediumGrid>;
+template class BasicBatchSimulation<LargeGrid>;
+template class BasicBatchSimulation<HugeGrid>;
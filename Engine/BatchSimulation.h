@@ -0,0 +1,93 @@
+/**
+	Runs many independent games of the same fixed grid at once, for evaluating bot policies
+	The games are stored as a structure of arrays (heads, directions, food, scores, ... one array each, indexed by game)
+	so one call to step() advances all of them: heads, bounds and food checks are computed for every game in one
+	branch-free loop the compiler vectorizes, then only the games that move touch their body and occupancy,
+	and only the games that ate respawn their food
+
+	Every game plays exactly like a BasicSimulation with the same seed, given one action per step
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+#include <cstdint>
+#include <vector>
+
+template<typename GridType>
+class BasicBatchSimulation : public SimulationBase {
+	static_assert(GridType::CELL_CAPACITY != DYNAMIC_CAPACITY, "Batch simulation needs a FixedGrid");
+
+public:
+	BasicBatchSimulation(int nGames, int speedLevel = 3, const GridType& grid = GridType());
+
+	void reset(int game, std::uint64_t seed);
+	void resetAll(const std::uint64_t* seeds);
+	int step(const Action* actions);
+
+	int getGameCount() const;
+	Outcome getOutcome(int game) const;
+	bool isGameOver(int game) const;
+	bool isWon(int game) const;
+	int getScore(int game) const;
+	int getLength(int game) const;
+	std::uint64_t getTick(int game) const;
+	Vec2_<int> getHeadLocation(int game) const;
+	Vec2_<int> getDirection(int game) const;
+	Vec2_<int> getFoodLocation(int game) const;
+	const Bitboard<GridType::CELL_CAPACITY>& getOccupancy(int game) const;
+	const GridType& getGrid() const;
+
+private:
+	enum State : std::int32_t {		// Stored per game
+		Running,		// 0, also tested by the vectorized loop
+		Died,
+		Won
+	};
+
+private:
+	GridType grid;
+	int nGames;
+	int scorePerFood;
+
+	static constexpr int LINK_WORDS = (GridType::CELL_CAPACITY * 2 + 63) / 64;
+
+	// Starting position shared by all games, copied on reset
+	std::uint64_t startLinks[LINK_WORDS];
+	std::int32_t startLinkCount;
+	Vec2_<int> startHead;
+	std::int32_t startTail;
+	Bitboard<GridType::CELL_CAPACITY> startOccupancy;
+	typename BasicFood<GridType>::FreeTiles startFreeTiles;
+	Vec2_<int> startFood;
+	bool isStartFoodCovered;	// The center is covered by the snake on very low grids, so the first food is random
+
+	// Hot arrays, read and written for every game by the vectorized part of step()
+	std::vector<std::int32_t> headX;
+	std::vector<std::int32_t> headY;
+	std::vector<std::int32_t> dirX;
+	std::vector<std::int32_t> dirY;
+	std::vector<std::int32_t> state;
+	std::vector<std::int32_t> nextTile;		// Tile the head moves to this step, or IDLE / WALL / OVER (see BatchSimulation.cpp)
+
+	// Per game data only touched by the games that move / eat
+	// Bodies are the PackedBody format spread over arrays: LINK_WORDS words of 2-bit links per game,
+	// plus the slot of the first link, the number of links and the tail's tile
+	std::vector<std::uint64_t> links;
+	std::vector<std::int32_t> linkFirst;
+	std::vector<std::int32_t> linkCount;
+	std::vector<std::int32_t> tailTile;
+	std::vector<Bitboard<GridType::CELL_CAPACITY>> occupancies;
+	std::vector<typename BasicFood<GridType>::FreeTiles> freeTiles;	// Empty on grids whose food probes the occupancy (see BasicFood::usesFreeTiles)
+	std::vector<std::int32_t> foodTile;		// Index of the food's tile (see Grid::toIndex)
+	std::vector<CounterRng> rngs;
+	std::vector<std::uint64_t> foodIndices;
+	std::vector<std::int32_t> scores;
+	std::vector<std::uint64_t> ticks;
+	std::vector<Outcome> outcomes;
+};
+
+using ClassicBatchSimulation = BasicBatchSimulation<ClassicGrid>;
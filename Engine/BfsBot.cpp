@@ -0,0 +1,137 @@
+#include "BfsBot.h"
+#include <algorithm>
+
+template<typename GridType>
+constexpr SimulationBase::Action BasicBfsBot<GridType>::MOVES[4];
+
+namespace {
+	const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };	// Directions of MOVES
+}
+
+/**
+	Constructs the bot, allocating its search buffers for the grid
+
+	@param grid Grid of the games the bot plays
+*/
+template<typename GridType>
+BasicBfsBot<GridType>::BasicBfsBot(const GridType& grid)
+	:
+	grid(grid),
+	queue(grid.getCellCount()),
+	visited(grid.getCellCount(), 0),
+	firstMove(grid.getCellCount(), 0),
+	floodFill(grid),
+	blocked(grid.getCellCount())
+{
+}
+
+/**
+	Picks the first move of a shortest path to the food
+	If the food can't be reached, takes the safe move from which the head can reach the most tiles
+
+	@param sim Game to play
+	@return action
+*/
+template<typename GridType>
+SimulationBase::Action BasicBfsBot<GridType>::act(const BasicSimulation<GridType>& sim)
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	const int move = findFirstMove(snek, sim.getFood().getLocation());
+	if (move >= 0) {
+		return MOVES[move];
+	}
+
+	const Vec2_<int> head = snek.getHeadLocation();
+	SimulationBase::Action action = SimulationBase::Action::None;	// Stays if trapped, every move is deadly
+	int mostRoom = -1;
+	for (int m = 0; m < 4; ++m) {
+		const Vec2_<int> next = head + STEPS[m];
+		if (!isFree(snek, next)) {
+			continue;
+		}
+		blocked = snek.getOccupancy();
+		blocked.reset(grid.toIndex(snek.getTailLocation()));	// The tail moves on
+		const int room = floodFill.countReachable(blocked, grid.toIndex(next));
+		if (room > mostRoom) {
+			action = MOVES[m];
+			mostRoom = room;
+		}
+	}
+	return action;
+}
+
+/**
+	Searches the free tiles breadth-first from the head until the target is reached
+
+	@param snek Snake, its body blocks the search
+	@param target Tile to reach
+	@return index into MOVES of the first move of a shortest path, -1 if the target can't be reached
+*/
+template<typename GridType>
+int BasicBfsBot<GridType>::findFirstMove(const BasicSnake<GridType>& snek, const Vec2_<int>& target)
+{
+	if (++generation == 0) {	// Generation wrapped around, old marks could be mistaken for new ones
+		std::fill(visited.begin(), visited.end(), 0);
+		generation = 1;
+	}
+
+	const Vec2_<int> head = snek.getHeadLocation();
+	const int targetIndex = grid.toIndex(target);
+	int front = 0;
+	int back = 0;
+
+	// The head's neighbours start the paths. The snake can't turn back, but that tile is its neck and blocked anyway
+	for (int m = 0; m < 4; ++m) {
+		const Vec2_<int> next = head + STEPS[m];
+		if (isFree(snek, next)) {
+			const int index = grid.toIndex(next);
+			if (index == targetIndex) {
+				return m;
+			}
+			visited[index] = generation;
+			firstMove[index] = std::int8_t(m);
+			queue[back++] = index;
+		}
+	}
+
+	while (front < back) {
+		const int index = queue[front++];
+		const Vec2_<int> tile = grid.toLocation(index);
+		for (int m = 0; m < 4; ++m) {
+			const Vec2_<int> next = tile + STEPS[m];
+			if (!isFree(snek, next)) {
+				continue;
+			}
+			const int nextIndex = grid.toIndex(next);
+			if (visited[nextIndex] == generation) {
+				continue;
+			}
+			if (nextIndex == targetIndex) {
+				return firstMove[index];
+			}
+			visited[nextIndex] = generation;
+			firstMove[nextIndex] = firstMove[index];
+			queue[back++] = nextIndex;
+		}
+	}
+	return -1;
+}
+
+/**
+	States whether or not the head could move to a tile: inside the grid and not covered by the snake
+
+	@param snek Snake
+	@param tile Tile to check
+	@return bool
+*/
+template<typename GridType>
+bool BasicBfsBot<GridType>::isFree(const BasicSnake<GridType>& snek, const Vec2_<int>& tile) const
+{
+	return grid.isInside(tile) && !snek.isInTile(tile);
+}
+
+template class BasicBfsBot<Grid>;
+template class BasicBfsBot<ClassicGrid>;
+template class BasicBfsBot<MediumGrid>;
+template class BasicBfsBot<LargeGrid>;
+template class BasicBfsBot<HugeGrid>;
@@ -0,0 +1,42 @@
+/**
+	Autopilot which steers the snake along a shortest path to the food, found by a breadth-first search over the tiles
+	A tile can be entered if it is inside the grid and not covered by the snake, the same checks Simulation::step makes
+	The search queue and the per tile arrays are allocated once, on construction, and reused by every decision;
+	visited tiles are marked with a generation number, so they don't have to be cleared between searches
+	When the food can't be reached, a flood fill picks the move which leaves the head the most room
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include "FloodFill.h"
+#include <cstdint>
+#include <vector>
+
+template<typename GridType>
+class BasicBfsBot : public BasicBot<GridType> {
+public:
+	BasicBfsBot(const GridType& grid = GridType());
+	SimulationBase::Action act(const BasicSimulation<GridType>& sim) override;
+
+private:
+	int findFirstMove(const BasicSnake<GridType>& snek, const Vec2_<int>& target);
+	bool isFree(const BasicSnake<GridType>& snek, const Vec2_<int>& tile) const;
+
+private:
+	static constexpr SimulationBase::Action MOVES[4] = {
+		SimulationBase::Action::Up, SimulationBase::Action::Down, SimulationBase::Action::Left, SimulationBase::Action::Right
+	};
+	GridType grid;
+	std::vector<std::int32_t> queue;		// Tiles to expand, each tile is queued at most once per search
+	std::vector<std::uint32_t> visited;		// Generation of the search which last reached the tile
+	std::vector<std::int8_t> firstMove;		// Index into MOVES of the head's move which starts the path to the tile
+	std::uint32_t generation = 0;
+	BasicFloodFill<GridType> floodFill;
+	Bitboard<GridType::CELL_CAPACITY> blocked;	// Occupancy after a move
+};
+
+using BfsBot = BasicBfsBot<ClassicGrid>;
@@ -0,0 +1,96 @@
+/**
+	Set of occupied tiles stored as one bit per tile of the grid (the classic 20x11 grid fits in four 64-bit words)
+	Tiles are addressed by their index (see Grid::toIndex)
+	With a compile time CAPACITY the words are a std::array, so loops over them are unrolled;
+	with DYNAMIC_CAPACITY they are allocated once, on construction
+
+	@author Benjamin Korady
+	@version 1.3	17/10/2026
+*/
+
+#pragma once
+
+#include "Storage.h"
+#include <algorithm>
+#include <cstdint>
+#include <assert.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+template<int CAPACITY>
+class Bitboard {
+public:
+	Bitboard(int cellCount)
+		:
+		words(Storage<std::uint64_t, WORD_CAPACITY>::make((cellCount + 63) / 64))
+	{
+		clear();
+	}
+	bool test(int index) const
+	{
+		return (words[index >> 6] >> (index & 63)) & 1u;
+	}
+	void set(int index)
+	{
+		words[index >> 6] |= std::uint64_t(1) << (index & 63);
+	}
+	void reset(int index)
+	{
+		words[index >> 6] &= ~(std::uint64_t(1) << (index & 63));
+	}
+	void clear()
+	{
+		std::fill(words.begin(), words.end(), 0);
+	}
+	int getWordCount() const
+	{
+		return (int)words.size();
+	}
+	std::uint64_t getWord(int index) const	// Bits of the tiles 64 * index to 64 * index + 63
+	{
+		return words[index];
+	}
+	int findClear(int rank, int cellCount) const	// Index of the rank-th (from 0) clear bit below cellCount, skips whole words by their bit counts
+	{
+		for (int w = 0; w < getWordCount(); ++w) {
+			std::uint64_t clear = ~words[w];
+			const int bitsLeft = cellCount - w * 64;
+			if (bitsLeft < 64) {
+				clear &= (std::uint64_t(1) << bitsLeft) - 1;
+			}
+			const int nClear = popCount(clear);
+			if (rank < nClear) {
+				for (; rank > 0; --rank) {
+					clear &= clear - 1;		// Drop the lowest clear bit
+				}
+				return w * 64 + countTrailingZeros(clear);
+			}
+			rank -= nClear;
+		}
+		assert(false);
+		return -1;
+	}
+	static int popCount(std::uint64_t word)
+	{
+#ifdef _MSC_VER
+		return (int)__popcnt64(word);
+#else
+		return __builtin_popcountll(word);
+#endif
+	}
+	static int countTrailingZeros(std::uint64_t word)	// word must not be 0
+	{
+#ifdef _MSC_VER
+		unsigned long index;
+		_BitScanForward64(&index, word);
+		return (int)index;
+#else
+		return __builtin_ctzll(word);
+#endif
+	}
+
+private:
+	static constexpr int WORD_CAPACITY = CAPACITY == DYNAMIC_CAPACITY ? DYNAMIC_CAPACITY : (CAPACITY + 63) / 64;
+	typename Storage<std::uint64_t, WORD_CAPACITY>::Type words;
+};
@@ -126,20 +126,6 @@ int Board::getHeight()
 	return LP_HEIGHT * LargePixel::SIZE;
 }
 
-/**
-	Converts a location of a tile (of the grid) to its corresponding top-left corner Large Pixel of the grid (game board)
-
-	@param tileLocation The location of the tile in grid-coordinates (tile coordinates)
-	@return gridLocation Location in large pixels on the grid
-*/
-Vec2_<int> Board::convertToGridLocation(Vec2_<int> tileLocation)
-{
-	return Vec2_<int>( {
-		tileLocation.x*(Tile::SIZE + Tile::SPACING) + LP_OFFSET_X,
-		tileLocation.y*(Tile::SIZE + Tile::SPACING) + LP_OFFSET_Y
-	});
-}
-
 /**
     Draws a string to the screen
 
@@ -216,6 +202,56 @@ void Board::draw()  const
 	}
 }
 
+/**
+    Draws all of the snake's segments and the spacing between them to the board
+
+    @param snek Snake to be drawn
+*/
+void Board::drawSnake(const ClassicSnake& snek) const
+{
+	Vec2_<int> nextLoc;		// Location of the previously drawn segment, which is the next one towards the head
+	bool isHead = true;
+	for (const Vec2_<int>& currentLoc : snek) {
+		const Vec2_<int> currentGridLocation = convertToGridLocation(currentLoc);
+
+		// A single segment occupies a 1x1 tile space, which is drawn as a 3x3 large pixel square
+		drawLargePixelRectangle(currentGridLocation, Tile::SIZE, Tile::SIZE);
+
+		if (!isHead) {	// If not drawing the head, draw spacing between segments (Head has no "next" segment)
+			for (int j = 0; j < Tile::SIZE; ++j) {
+				//  next segment is to the right
+				if (nextLoc.x - currentLoc.x == 1)
+					drawLargePixel({ currentGridLocation.x + Tile::SIZE, currentGridLocation.y + j }); // Draw vertical line to the right of the segment
+				//  next segment is to the left
+				else if (nextLoc.x - currentLoc.x == -1)
+					drawLargePixel({ currentGridLocation.x - 1, currentGridLocation.y + j });	// Draw vertical line to the left of the segment
+				//  next segment is below 
+				else if (nextLoc.y - currentLoc.y == 1)
+					drawLargePixel({ currentGridLocation.x + j, currentGridLocation.y + Tile::SIZE });	// Horizontal line underneath
+				//  next segment is above
+				else if (nextLoc.y - currentLoc.y == -1)
+					drawLargePixel({ currentGridLocation.x + j , currentGridLocation.y - 1 });	// Horizontal line above
+			}
+		}
+		nextLoc = currentLoc;
+		isHead = false;
+	}
+}
+
+/**
+    Draws the food onto the board
+
+    @param nom Food to be drawn
+*/
+void Board::drawFood(const ClassicFood& nom) const
+{
+	const Vec2_<int> gridLocation = convertToGridLocation(nom.getLocation());
+	drawLargePixel({ gridLocation.x + 1,	gridLocation.y	   }, 1);
+	drawLargePixel({ gridLocation.x,		gridLocation.y + 1 }, 1);
+	drawLargePixel({ gridLocation.x + 2,	gridLocation.y + 1 }, 1);
+	drawLargePixel({ gridLocation.x + 1,	gridLocation.y + 2 }, 1);
+}
+
 /**
     Checks if input location is inside the game board
 
@@ -226,9 +262,5 @@ void Board::draw()  const
 
 bool Board::isInsideBoard(const Vec2_<int> loc) const
 {
-	return
-		loc.x >= 0 &&
-		loc.x < Grid::WIDTH &&
-		loc.y >= 0 &&
-		loc.y < Grid::HEIGHT;	
+	return grid.isInside(loc);
 }
@@ -9,6 +9,9 @@ Manages the gaming board
 #include "Graphics.h"
 #include <string>
 #include "Vec2.h"
+#include "Grid.h"
+#include "Snake.h"
+#include "Food.h"
 #include <vector>
 
 class Board {
@@ -22,15 +25,13 @@ public:
 		static constexpr int SIZE = 3;		// large pixels
 		static constexpr int SPACING = 1;	// large pixels
 	};
-	struct Grid {
-		static constexpr int WIDTH = 20;	// tiles
-		static constexpr int HEIGHT = 11;   // tiles
-	};
 
 public:
 	Board(Graphics& gfx);
 
 	void draw() const;
+	void drawSnake(const ClassicSnake& snek) const;
+	void drawFood(const ClassicFood& nom) const;
 
 	bool isInsideBoard(const Vec2_<int> location) const;
 	void drawString(Vec2_<int> location, std::string input, const bool invert) const;
@@ -41,18 +42,35 @@ public:
 
 	static int getWidth();
 	static int getHeight();
-	static Vec2_<int> convertToGridLocation(Vec2_<int> tileLocation);
+
+	/**
+		Converts a location of a tile (of the grid) to its corresponding top-left corner Large Pixel of the grid (game board)
+		Defined here so it folds to a constant wherever the tile location is known at compile time
+
+		@param tileLocation The location of the tile in grid-coordinates (tile coordinates)
+		@return gridLocation Location in large pixels on the grid
+	*/
+	static constexpr Vec2_<int> convertToGridLocation(Vec2_<int> tileLocation)
+	{
+		return {
+			tileLocation.x*(Tile::SIZE + Tile::SPACING) + LP_OFFSET_X,
+			tileLocation.y*(Tile::SIZE + Tile::SPACING) + LP_OFFSET_Y
+		};
+	}
+
+private:
+	static constexpr int LP_OFFSET_X = 2;	// Large pixels between the frame and the first tile
+	static constexpr int LP_OFFSET_Y = 2;
 
 public:
 	static constexpr int DEFAULT_PIXEL_SPACING = 1;
 	static constexpr int LETTER_SPACING = 1;
-	static constexpr int LP_WIDTH = 83;
-	static constexpr int LP_HEIGHT = 47;
+	// Size of the screen in large pixels, derived from the classic grid (83 x 47)
+	static constexpr int LP_WIDTH = 2 * LP_OFFSET_X + Grid::CLASSIC_WIDTH * (Tile::SIZE + Tile::SPACING) - Tile::SPACING;
+	static constexpr int LP_HEIGHT = 2 * LP_OFFSET_Y + Grid::CLASSIC_HEIGHT * (Tile::SIZE + Tile::SPACING) - Tile::SPACING;
 
 private:
-	Grid grid;
-	static constexpr int LP_OFFSET_X = 2;
-	static constexpr int LP_OFFSET_Y = 2;
+	Grid grid;	// The board only draws the classic grid
 
 private:
     Color bgColor;
@@ -0,0 +1,22 @@
+/**
+	Interface of the autopilots: a bot looks at the game before every step and picks the action to play,
+	the same way the Game turns key presses into actions
+	A bot may keep state (e.g. search buffers) between steps, so every thread uses its own bot
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+
+template<typename GridType>
+class BasicBot {
+public:
+	virtual ~BasicBot() = default;
+	virtual void reset(const BasicSimulation<GridType>&) {}		// Called after the game is reset, before its first step
+	virtual SimulationBase::Action act(const BasicSimulation<GridType>& sim) = 0;
+};
+
+using Bot = BasicBot<ClassicGrid>;
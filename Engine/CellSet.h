@@ -0,0 +1,115 @@
+/**
+	Set of tile indices with constant time insert, erase, lookup and random access:
+	a dense array of the members plus a map from each tile to its position in that array
+	Holds indices from 0 to capacity - 1. Stored in std::arrays of 16-bit indices for a compile time CAPACITY
+	below 65536 (so the set of a 64x64 grid is 16 KB), or allocated once, on construction, for DYNAMIC_CAPACITY
+	EmptyCellSet stands in for a set that is never used and takes no memory (see BasicFood)
+
+	@author Benjamin Korady
+	@version 1.3	17/10/2026
+*/
+
+#pragma once
+
+#include "Storage.h"
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <assert.h>
+
+template<int CAPACITY>
+class CellSet {
+public:
+	CellSet(int capacity)
+		:
+		members(Storage<Index, CAPACITY>::make(capacity)),
+		positions(Storage<Index, CAPACITY>::make(capacity))
+	{
+		clear();
+	}
+	void insert(int index)
+	{
+		assert(!contains(index));
+		positions[index] = Index(count);
+		members[count++] = Index(index);
+	}
+	void erase(int index)
+	{
+		assert(contains(index));
+		const int position = positions[index];
+		const Index last = members[--count];	// Move the last member into the gap
+		members[position] = last;
+		positions[last] = Index(position);
+		positions[index] = NONE;
+	}
+	bool contains(int index) const
+	{
+		return positions[index] != NONE;
+	}
+	void clear()
+	{
+		std::fill(positions.begin(), positions.end(), NONE);
+		count = 0;
+	}
+	void fill()		// Inserts every index from 0 to capacity - 1
+	{
+		count = (int)members.size();
+		for (int i = 0; i < count; ++i) {
+			positions[i] = Index(i);
+			members[i] = Index(i);
+		}
+	}
+	int operator[](int position) const
+	{
+		assert(position >= 0 && position < count);
+		return members[position];
+	}
+	int size() const
+	{
+		return count;
+	}
+	bool empty() const
+	{
+		return count == 0;
+	}
+
+private:
+	using Index = typename std::conditional<CAPACITY != DYNAMIC_CAPACITY && CAPACITY < 65536, std::uint16_t, int>::type;
+	static constexpr Index NONE = Index(-1);
+	typename Storage<Index, CAPACITY>::Type members;	// Indices in the set, in no particular order
+	typename Storage<Index, CAPACITY>::Type positions;	// Position of each index in members, NONE if not in the set
+	int count = 0;
+};
+
+template<int CAPACITY>
+constexpr typename CellSet<CAPACITY>::Index CellSet<CAPACITY>::NONE;
+
+class EmptyCellSet {
+public:
+	EmptyCellSet(int capacity)
+	{
+		assert(capacity == 0);
+		(void)capacity;
+	}
+	void insert(int) {}
+	void erase(int) {}
+	bool contains(int) const
+	{
+		return false;
+	}
+	void clear() {}
+	void fill() {}
+	int operator[](int) const
+	{
+		assert(false);
+		return -1;
+	}
+	int size() const
+	{
+		return 0;
+	}
+	bool empty() const
+	{
+		return true;
+	}
+};
@@ -0,0 +1,45 @@
+/**
+	Counter-based random number generator: the n-th number of a stream is a hash of (seed, n),
+	so there is no state to advance or copy besides the seed, any position of the stream can be read directly (jump ahead),
+	and generators for different games / threads are independent
+	Uses the SplitMix64 finalizer, which passes BigCrush for consecutive counters
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <assert.h>
+
+class CounterRng {
+public:
+	CounterRng(std::uint64_t seed = 0)
+		:
+		seed(seed)
+	{}
+	std::uint64_t operator()(std::uint64_t counter) const	// 64 random bits for position counter of the stream
+	{
+		return mix(seed + (counter + 1) * GOLDEN_GAMMA);
+	}
+	int below(std::uint64_t counter, int bound) const	// Integer in [0, bound), bias is below bound / 2^32
+	{
+		assert(bound > 0);
+		return int(((*this)(counter) >> 32) * std::uint64_t(bound) >> 32);
+	}
+	std::uint64_t getSeed() const
+	{
+		return seed;
+	}
+	static std::uint64_t mix(std::uint64_t z)
+	{
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+private:
+	static constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+	std::uint64_t seed;
+};
@@ -0,0 +1,323 @@
+#include "DistanceField.h"
+#include <algorithm>
+#include <stdlib.h>
+
+template<typename GridType>
+constexpr std::int32_t BasicDistanceField<GridType>::UNREACHABLE;
+
+namespace {
+	const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };
+}
+
+/**
+	Constructs the field, allocating its buffers for the grid. Every tile is unreachable until the first update
+
+	@param grid Grid of the games the field follows
+*/
+template<typename GridType>
+BasicDistanceField<GridType>::BasicDistanceField(const GridType& grid)
+	:
+	grid(grid),
+	distances(grid.getCellCount(), UNREACHABLE),
+	blocked(grid.getCellCount()),
+	queue(grid.getCellCount()),
+	checked(grid.getCellCount(), 0),
+	affected(grid.getCellCount(), 0)
+{
+	heap.reserve(std::size_t(grid.getCellCount()) * 5);	// Every tile is pushed once, plus once for each of its 4 neighbours lowering it
+}
+
+/**
+	Brings the field up to date with a game, call it after every step
+	When the game is one move further than at the last update, only the distances which depend on the two tiles
+	the move changed are repaired. After the food respawned, a reset, or a different game it searches from scratch
+
+	@param sim Game to follow
+*/
+template<typename GridType>
+void BasicDistanceField<GridType>::update(const BasicSimulation<GridType>& sim)
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	const int newHead = grid.toIndex(snek.getHeadLocation());
+	const int newTail = grid.toIndex(snek.getTailLocation());
+	if (head < 0 || sim.getSeed() != seed || sim.getFood().getFoodIndex() != foodIndex || sim.getTick() < tick || sim.getTick() > tick + 1) {
+		rebuild(sim);
+		return;
+	}
+	if (newHead == head && newTail == tail) {	// Snake didn't move (no direction yet, or it died)
+		tick = sim.getTick();
+		return;
+	}
+	const Vec2_<int> headStep = grid.toLocation(newHead) - grid.toLocation(head);
+	if (sim.getTick() != tick + 1 || abs(headStep.x) + abs(headStep.y) != 1) {
+		rebuild(sim);
+		return;
+	}
+
+	block(newHead);
+	if (newTail != tail) {
+		unblock(tail);
+	}
+	head = newHead;
+	tail = newTail;
+	tick = sim.getTick();
+}
+
+/**
+	Searches the distances from scratch, breadth-first from the food
+
+	@param sim Game to follow
+*/
+template<typename GridType>
+void BasicDistanceField<GridType>::rebuild(const BasicSimulation<GridType>& sim)
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	blocked = snek.getOccupancy();
+	std::fill(distances.begin(), distances.end(), UNREACHABLE);
+
+	const int food = grid.toIndex(sim.getFood().getLocation());
+	if (!blocked.test(food)) {	// Only covered once the snake has filled the board
+		int front = 0;
+		int back = 0;
+		distances[food] = 0;
+		queue[back++] = food;
+		while (front < back) {
+			const int tile = queue[front++];
+			const Vec2_<int> location = grid.toLocation(tile);
+			for (const Vec2_<int>& step : STEPS) {
+				const Vec2_<int> next = location + step;
+				if (!grid.isInside(next)) {
+					continue;
+				}
+				const int nextTile = grid.toIndex(next);
+				if (!blocked.test(nextTile) && distances[nextTile] == UNREACHABLE) {
+					distances[nextTile] = distances[tile] + 1;
+					queue[back++] = nextTile;
+				}
+			}
+		}
+	}
+
+	seed = sim.getSeed();
+	foodIndex = sim.getFood().getFoodIndex();
+	tick = sim.getTick();
+	head = grid.toIndex(snek.getHeadLocation());
+	tail = grid.toIndex(snek.getTailLocation());
+}
+
+/**
+	Returns the number of moves from a tile to the food
+
+	@param tile Location in Tile units
+	@return distance, UNREACHABLE for tiles covered by the snake and tiles it walls off from the food
+*/
+template<typename GridType>
+int BasicDistanceField<GridType>::getDistance(const Vec2_<int>& tile) const
+{
+	return distances[grid.toIndex(tile)];
+}
+
+/**
+	Returns the first step of a shortest path from a tile (e.g. the head) to the food
+
+	@param from Location in Tile units
+	@return direction towards the neighbour closest to the food, DIR_ZERO if the food can't be reached from any neighbour
+*/
+template<typename GridType>
+Vec2_<int> BasicDistanceField<GridType>::getStepToFood(const Vec2_<int>& from) const
+{
+	Vec2_<int> best = { DIR_ZERO };
+	std::int32_t bestDistance = UNREACHABLE;
+	for (const Vec2_<int>& step : STEPS) {
+		const Vec2_<int> next = from + step;
+		if (grid.isInside(next) && distances[grid.toIndex(next)] < bestDistance) {
+			best = step;
+			bestDistance = distances[grid.toIndex(next)];
+		}
+	}
+	return best;
+}
+
+/**
+	Blocks a tile (the new head) and repairs the distances which went through it
+	First finds the tiles which lost every shortest path: those whose neighbours one step closer to the food
+	are all blocked or lost theirs, going outwards from the tile level by level. Only those tiles change,
+	they get their new distances from their other neighbours, smallest first (Dijkstra)
+
+	@param tile Tile index
+*/
+template<typename GridType>
+void BasicDistanceField<GridType>::block(int tile)
+{
+	blocked.set(tile);
+	const std::int32_t oldDistance = distances[tile];
+	distances[tile] = UNREACHABLE;
+	if (oldDistance == UNREACHABLE) {
+		return;
+	}
+	newGeneration();
+
+	// Tiles which may have lost their shortest paths, queued at most once, in order of distance
+	int front = 0;
+	int back = 0;
+	const auto queueFollowers = [&](int from, std::int32_t distance) {
+		const Vec2_<int> location = grid.toLocation(from);
+		for (const Vec2_<int>& step : STEPS) {
+			const Vec2_<int> next = location + step;
+			if (!grid.isInside(next)) {
+				continue;
+			}
+			const int nextTile = grid.toIndex(next);
+			if (distances[nextTile] == distance + 1 && !blocked.test(nextTile) && checked[nextTile] != generation) {
+				checked[nextTile] = generation;
+				queue[back++] = nextTile;
+			}
+		}
+	};
+	queueFollowers(tile, oldDistance);
+	while (front < back) {
+		const int candidate = queue[front++];
+		if (!hasParent(candidate)) {
+			affected[candidate] = generation;
+			queueFollowers(candidate, distances[candidate]);
+		}
+	}
+
+	// New distances of the affected tiles
+	for (int i = 0; i < back; ++i) {
+		if (affected[queue[i]] == generation) {
+			distances[queue[i]] = UNREACHABLE;
+		}
+	}
+	heap.clear();
+	for (int i = 0; i < back; ++i) {
+		const int candidate = queue[i];
+		if (affected[candidate] != generation) {
+			continue;
+		}
+		const std::int32_t minimum = getNeighbourMinimum(candidate);
+		if (minimum != UNREACHABLE) {
+			distances[candidate] = minimum + 1;
+			heap.push_back({ minimum + 1, candidate });
+			std::push_heap(heap.begin(), heap.end());
+		}
+	}
+	while (!heap.empty()) {
+		std::pop_heap(heap.begin(), heap.end());
+		const Entry entry = heap.back();
+		heap.pop_back();
+		if (entry.distance != distances[entry.tile]) {
+			continue;	// Lowered since it was pushed
+		}
+		const Vec2_<int> location = grid.toLocation(entry.tile);
+		for (const Vec2_<int>& step : STEPS) {
+			const Vec2_<int> next = location + step;
+			if (!grid.isInside(next)) {
+				continue;
+			}
+			const int nextTile = grid.toIndex(next);
+			if (affected[nextTile] == generation && distances[nextTile] > entry.distance + 1) {
+				distances[nextTile] = entry.distance + 1;
+				heap.push_back({ entry.distance + 1, nextTile });
+				std::push_heap(heap.begin(), heap.end());
+			}
+		}
+	}
+}
+
+/**
+	Frees a tile (the old tail) and lowers the distances which get shorter through it, breadth-first from the tile
+
+	@param tile Tile index
+*/
+template<typename GridType>
+void BasicDistanceField<GridType>::unblock(int tile)
+{
+	blocked.reset(tile);
+	const std::int32_t minimum = getNeighbourMinimum(tile);
+	if (minimum == UNREACHABLE) {
+		return;		// Walled off from the food, and so is everything it would open up
+	}
+	distances[tile] = minimum + 1;
+
+	int front = 0;
+	int back = 0;
+	queue[back++] = tile;
+	while (front < back) {
+		const int current = queue[front++];
+		const Vec2_<int> location = grid.toLocation(current);
+		for (const Vec2_<int>& step : STEPS) {
+			const Vec2_<int> next = location + step;
+			if (!grid.isInside(next)) {
+				continue;
+			}
+			const int nextTile = grid.toIndex(next);
+			if (!blocked.test(nextTile) && distances[nextTile] > distances[current] + 1) {
+				distances[nextTile] = distances[current] + 1;
+				queue[back++] = nextTile;
+			}
+		}
+	}
+}
+
+/**
+	States whether or not a tile still has a neighbour one step closer to the food, which didn't lose its own shortest paths
+
+	@param tile Tile index
+	@return bool
+*/
+template<typename GridType>
+bool BasicDistanceField<GridType>::hasParent(int tile) const
+{
+	const Vec2_<int> location = grid.toLocation(tile);
+	for (const Vec2_<int>& step : STEPS) {
+		const Vec2_<int> next = location + step;
+		if (!grid.isInside(next)) {
+			continue;
+		}
+		const int nextTile = grid.toIndex(next);
+		if (distances[nextTile] == distances[tile] - 1 && affected[nextTile] != generation) {
+			return true;	// Blocked tiles are UNREACHABLE, so they never match
+		}
+	}
+	return false;
+}
+
+/**
+	Returns the smallest distance among a tile's neighbours
+
+	@param tile Tile index
+	@return distance, UNREACHABLE if no neighbour can reach the food
+*/
+template<typename GridType>
+std::int32_t BasicDistanceField<GridType>::getNeighbourMinimum(int tile) const
+{
+	const Vec2_<int> location = grid.toLocation(tile);
+	std::int32_t minimum = UNREACHABLE;
+	for (const Vec2_<int>& step : STEPS) {
+		const Vec2_<int> next = location + step;
+		if (grid.isInside(next)) {
+			minimum = std::min(minimum, distances[grid.toIndex(next)]);
+		}
+	}
+	return minimum;
+}
+
+/**
+	Starts a new generation of the checked / affected marks, clearing them when the counter wraps around
+*/
+template<typename GridType>
+void BasicDistanceField<GridType>::newGeneration()
+{
+	if (++generation == 0) {
+		std::fill(checked.begin(), checked.end(), 0);
+		std::fill(affected.begin(), affected.end(), 0);
+		generation = 1;
+	}
+}
+
+template class BasicDistanceField<Grid>;
+template class BasicDistanceField<ClassicGrid>;
+template class BasicDistanceField<MediumGrid>;
+template class BasicDistanceField<LargeGrid>;
+template class BasicDistanceField<HugeGrid>;
@@ -0,0 +1,71 @@
+/**
+	Distance from the food to every tile, in moves through tiles not covered by the snake (the head blocks too),
+	kept up to date while a game is played: a move only blocks the new head's tile and frees the old tail's tile,
+	so update repairs the distances around those two tiles instead of searching the whole grid again. The field is
+	searched from scratch only when the food respawns, or when the game doesn't continue from the last update
+	Queries are lookups, e.g. the head's next step along a shortest path is the neighbour with the smallest distance
+
+	The field is optional and kept outside of the simulation (a GameState stays a small, plain copyable value):
+	call update after every step of the games it follows
+	All buffers are allocated once, on construction
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+#include "Bitboard.h"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+template<typename GridType>
+class BasicDistanceField {
+public:
+	BasicDistanceField(const GridType& grid = GridType());
+
+	void update(const BasicSimulation<GridType>& sim);
+	void rebuild(const BasicSimulation<GridType>& sim);
+	int getDistance(const Vec2_<int>& tile) const;
+	Vec2_<int> getStepToFood(const Vec2_<int>& from) const;
+
+public:
+	static constexpr std::int32_t UNREACHABLE = std::numeric_limits<std::int32_t>::max();
+
+private:
+	void block(int tile);
+	void unblock(int tile);
+	bool hasParent(int tile) const;
+	std::int32_t getNeighbourMinimum(int tile) const;
+	void newGeneration();
+
+private:
+	struct Entry {	// Tile waiting in the heap, ordered by distance
+		std::int32_t distance;
+		std::int32_t tile;
+		bool operator<(const Entry& rhs) const
+		{
+			return distance > rhs.distance;		// std::push_heap keeps the largest on top, the smallest distance has to be
+		}
+	};
+
+	GridType grid;
+	std::vector<std::int32_t> distances;	// Per tile, UNREACHABLE for blocked tiles and tiles walled off from the food
+	Bitboard<GridType::CELL_CAPACITY> blocked;
+	std::vector<std::int32_t> queue;
+	std::vector<Entry> heap;
+	std::vector<std::uint32_t> checked;		// Generation of the last block which decided whether the tile lost its shortest paths
+	std::vector<std::uint32_t> affected;	// Generation of the last block which took away all of the tile's shortest paths
+	std::uint32_t generation = 0;
+
+	// Game the field was last updated for
+	std::uint64_t seed = 0;
+	std::uint64_t foodIndex = 0;
+	std::uint64_t tick = 0;
+	int head = -1;
+	int tail = -1;
+};
+
+using DistanceField = BasicDistanceField<ClassicGrid>;
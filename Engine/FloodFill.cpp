@@ -0,0 +1,216 @@
+#include "FloodFill.h"
+#include <assert.h>
+
+/**
+	Constructs the fill, precomputing the column masks of the grid
+
+	@param grid Grid of the boards which are queried
+*/
+template<typename GridType>
+BasicFloodFill<GridType>::BasicFloodFill(const GridType& grid)
+	:
+	grid(grid),
+	nWords((grid.getCellCount() + 63) / 64),
+	inside(Storage<std::uint64_t, WORD_CAPACITY>::make(nWords)),
+	notFirstColumn(Storage<std::uint64_t, WORD_CAPACITY>::make(nWords)),
+	notLastColumn(Storage<std::uint64_t, WORD_CAPACITY>::make(nWords)),
+	free(Storage<std::uint64_t, WORD_CAPACITY>::make(nWords)),
+	reached(Storage<std::uint64_t, WORD_CAPACITY>::make(nWords))
+{
+	for (int w = 0; w < nWords; ++w) {
+		inside[w] = 0;
+		notFirstColumn[w] = 0;
+		notLastColumn[w] = 0;
+	}
+	for (int tile = 0; tile < grid.getCellCount(); ++tile) {
+		const std::uint64_t bit = std::uint64_t(1) << (tile & 63);
+		const int x = grid.toLocation(tile).x;
+		inside[tile >> 6] |= bit;
+		if (x != 0) {
+			notFirstColumn[tile >> 6] |= bit;
+		}
+		if (x != grid.getWidth() - 1) {
+			notLastColumn[tile >> 6] |= bit;
+		}
+	}
+}
+
+/**
+	Counts the tiles which can be reached from a tile, moving up / down / left / right through tiles which aren't blocked
+
+	@param blocked Tiles which can't be entered
+	@param start Tile index to start from, may be blocked (e.g. the head)
+	@return number of reachable tiles which aren't blocked, start included if it isn't blocked
+*/
+template<typename GridType>
+int BasicFloodFill<GridType>::countReachable(const Board& blocked, int start)
+{
+	setFree(blocked);
+	spread(start, -1);
+	int count = 0;
+	for (int w = 0; w < nWords; ++w) {
+		count += Board::popCount(reached[w] & free[w]);
+	}
+	return count;
+}
+
+/**
+	States whether or not a tile can be reached from another one, moving up / down / left / right through tiles
+	which aren't blocked. Stops as soon as it is reached
+
+	@param blocked Tiles which can't be entered
+	@param start Tile index to start from, may be blocked (e.g. the head)
+	@param target Tile index to reach, may be blocked (e.g. the tail), only the tiles on the way have to be free
+	@return bool
+*/
+template<typename GridType>
+bool BasicFloodFill<GridType>::isReachable(const Board& blocked, int start, int target)
+{
+	setFree(blocked);
+	free[target >> 6] |= std::uint64_t(1) << (target & 63);
+	return spread(start, target);
+}
+
+/**
+	Counts the free tiles the snake's head can still reach
+
+	@param snek Snake, its body blocks the way
+	@return number of tiles
+*/
+template<typename GridType>
+int BasicFloodFill<GridType>::countReachable(const BasicSnake<GridType>& snek)
+{
+	return countReachable(snek.getOccupancy(), grid.toIndex(snek.getHeadLocation()));
+}
+
+/**
+	States whether or not there is a way from the snake's head to its tail. While there is, the snake can follow
+	its tail and survive, whatever the food does
+
+	@param snek Snake, its body blocks the way
+	@return bool
+*/
+template<typename GridType>
+bool BasicFloodFill<GridType>::isTailReachable(const BasicSnake<GridType>& snek)
+{
+	return isReachable(snek.getOccupancy(), grid.toIndex(snek.getHeadLocation()), grid.toIndex(snek.getTailLocation()));
+}
+
+/**
+	Sets the tiles the fill may enter: the grid's tiles which aren't blocked
+
+	@param blocked Tiles which can't be entered
+*/
+template<typename GridType>
+void BasicFloodFill<GridType>::setFree(const Board& blocked)
+{
+	for (int w = 0; w < nWords; ++w) {
+		free[w] = inside[w] & ~blocked.getWord(w);
+	}
+}
+
+/**
+	Grows the reached set from the start tile through the free tiles until it stops growing or the target is reached
+	Sweeps the words forward (taking in what was reached above and to the left) and backward (below and to the right)
+	in place, so one sweep carries the fill along a whole column, and fills each word as far as it can get within it
+
+	@param start Tile index to start from
+	@param target Tile index to stop at, -1 to fill everything
+	@return whether or not the target was reached
+*/
+template<typename GridType>
+bool BasicFloodFill<GridType>::spread(int start, int target)
+{
+	const int width = grid.getWidth();
+	const int rowWords = width >> 6;	// Up / down is a shift by width bits: whole words plus a shift within a word
+	const int rowBits = width & 63;
+	for (int w = 0; w < nWords; ++w) {
+		reached[w] = 0;
+	}
+	reached[start >> 6] |= std::uint64_t(1) << (start & 63);
+	fillWord(start >> 6);
+
+	const auto wordAt = [this](int w) { return w >= 0 && w < nWords ? reached[w] : std::uint64_t(0); };
+	for (;;) {
+		bool isGrowing = false;
+		for (int w = 1; w < nWords; ++w) {			// Forward: from the tiles above and to the left
+			std::uint64_t incoming = (reached[w - 1] >> 63) & notFirstColumn[w];
+			incoming |= rowBits == 0 ? wordAt(w - rowWords) : (wordAt(w - rowWords) << rowBits) | (wordAt(w - rowWords - 1) >> (64 - rowBits));
+			incoming &= free[w] & ~reached[w];
+			if (incoming != 0) {
+				reached[w] |= incoming;
+				fillWord(w);
+				isGrowing = true;
+			}
+		}
+		for (int w = nWords - 2; w >= 0; --w) {	// Backward: from the tiles below and to the right
+			std::uint64_t incoming = (reached[w + 1] << 63) & notLastColumn[w];
+			incoming |= rowBits == 0 ? wordAt(w + rowWords) : (wordAt(w + rowWords) >> rowBits) | (wordAt(w + rowWords + 1) << (64 - rowBits));
+			incoming &= free[w] & ~reached[w];
+			if (incoming != 0) {
+				reached[w] |= incoming;
+				fillWord(w);
+				isGrowing = true;
+			}
+		}
+		if (target >= 0 && ((reached[target >> 6] >> (target & 63)) & 1)) {
+			return true;
+		}
+		if (!isGrowing) {
+			return false;
+		}
+	}
+}
+
+/**
+	Spreads the reached tiles of one word to every free tile they are connected to within the word:
+	along the rows in both directions and, when several rows share the word, up and down, doubling the distance
+	covered at every step (Kogge-Stone), until the word stops growing
+
+	@param w Index of the word
+*/
+template<typename GridType>
+void BasicFloodFill<GridType>::fillWord(int w)
+{
+	const int width = grid.getWidth();
+	const std::uint64_t rightRun = free[w] & notFirstColumn[w];
+	const std::uint64_t leftRun = free[w] & notLastColumn[w];
+	std::uint64_t word = reached[w];
+	for (;;) {
+		const std::uint64_t old = word;
+		std::uint64_t right = word;
+		std::uint64_t left = word;
+		std::uint64_t rightOpen = rightRun;
+		std::uint64_t leftOpen = leftRun;
+		for (int shift = 1; shift < 64; shift *= 2) {
+			right |= rightOpen & (right << shift);
+			rightOpen &= rightOpen << shift;
+			left |= leftOpen & (left >> shift);
+			leftOpen &= leftOpen >> shift;
+		}
+		word = right | left;
+		if (width < 64) {
+			std::uint64_t down = word;
+			std::uint64_t up = word;
+			std::uint64_t downOpen = free[w];
+			std::uint64_t upOpen = free[w];
+			for (int shift = width; shift < 64; shift *= 2) {
+				down |= downOpen & (down << shift);
+				downOpen &= downOpen << shift;
+				up |= upOpen & (up >> shift);
+				upOpen &= upOpen >> shift;
+			}
+			word = down | up;
+		}
+		if (word == old) {
+			break;
+		}
+	}
+	reached[w] = word;
+}
+
+template class BasicFloodFill<Grid>;
+template class BasicFloodFill<ClassicGrid>;
+template class BasicFloodFill<MediumGrid>;
+template class BasicFloodFill<LargeGrid>;
+template class BasicFloodFill<HugeGrid>;
@@ -0,0 +1,51 @@
+/**
+	Reachability queries over a Bitboard of blocked tiles (e.g. the snake's occupancy): how many tiles can be reached
+	from a tile, and whether a tile (e.g. the tail) can be reached at all
+	Works on whole 64-bit words instead of visiting tiles one by one: within a word the reached tiles spread along
+	the free runs with shifts and masks (by 1 bit for left / right, by the grid width for up / down when rows share
+	a word), and sweeps over the words, forward then backward, carry the fill into the neighbouring words
+	until it stops growing. A sweep carries the fill along a whole column, so few sweeps are needed
+	The word buffers are allocated once, on construction, so queries don't allocate
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Grid.h"
+#include "Bitboard.h"
+#include "Snake.h"
+#include <cstdint>
+
+template<typename GridType>
+class BasicFloodFill {
+public:
+	using Board = Bitboard<GridType::CELL_CAPACITY>;
+
+	BasicFloodFill(const GridType& grid = GridType());
+
+	int countReachable(const Board& blocked, int start);
+	bool isReachable(const Board& blocked, int start, int target);
+	int countReachable(const BasicSnake<GridType>& snek);
+	bool isTailReachable(const BasicSnake<GridType>& snek);
+
+private:
+	void setFree(const Board& blocked);
+	bool spread(int start, int target);
+	void fillWord(int w);
+
+private:
+	static constexpr int WORD_CAPACITY = GridType::CELL_CAPACITY == DYNAMIC_CAPACITY ? DYNAMIC_CAPACITY : (GridType::CELL_CAPACITY + 63) / 64;
+	using Words = typename Storage<std::uint64_t, WORD_CAPACITY>::Type;
+
+	GridType grid;
+	int nWords;
+	Words inside;			// Tiles of the grid, the bits of the last word past the last tile are clear
+	Words notFirstColumn;	// Tiles which can be entered from their left neighbour
+	Words notLastColumn;	// Tiles which can be entered from their right neighbour
+	Words free;				// Tiles the fill may enter
+	Words reached;
+};
+
+using FloodFill = BasicFloodFill<ClassicGrid>;
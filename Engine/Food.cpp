@@ -1,78 +1,229 @@
 #include "Food.h"
+#include "Zobrist.h"
+#include <assert.h>
 
 /**
     Constructs food object at the center of the screen
+
+    @param grid Grid the food is placed on (a default constructed Grid is the classic 20x11 grid)
+    @param seed Seed of the food's random placement
 */
-Food::Food()
+template<typename GridType>
+BasicFood<GridType>::BasicFood(const GridType& grid, std::uint64_t seed)
 	:
-	location(Board::Grid::WIDTH/2, Board::Grid::HEIGHT/2),
-	rng(std::random_device()())
+	BasicFood(grid, { grid.getWidth() / 2, grid.getHeight() / 2 }, seed)
 {
 }
 
 /**
     Constructs food object at the input location
 
+    @param grid Grid the food is placed on
     @param loc
     Specifies the location where the object is to be created
+    @param seed Seed of the food's random placement
 */
-Food::Food(Vec2_<int> tileLocation)
+template<typename GridType>
+BasicFood<GridType>::BasicFood(const GridType& grid, Vec2_<int> tileLocation, std::uint64_t seed)
 	:
 	location(tileLocation),
-	rng(std::random_device()())
+	grid(grid),
+	freeTiles(usesFreeTiles(grid) ? grid.getCellCount() : 0),
+	rng(seed),
+	hash(computeHash())
 {
+	freeTiles.fill();
 }
 
 /**
-    Draws the food onto the board
+    Returns the location of the food
 
-    @param brd
-    Board object reference
+    @return loc
 */
-void Food::draw(Board &brd) const
+template<typename GridType>
+Vec2_<int> BasicFood<GridType>::getLocation() const
 {
-	Vec2_<int> gridLocation = Board::convertToGridLocation(location);
-	brd.drawLargePixel({ gridLocation.x + 1,	gridLocation.y	   }, 1);
-	brd.drawLargePixel({ gridLocation.x,		gridLocation.y + 1 }, 1);
-	brd.drawLargePixel({ gridLocation.x + 2,	gridLocation.y + 1 }, 1);
-	brd.drawLargePixel({ gridLocation.x + 1,	gridLocation.y + 2 }, 1);
+	return location;
+}
+
+/**
+    Resets the food's location back to the center of the screen ((10, 5) on the classic grid) and rebuilds the set of free tiles
+    This is the only place which does work proportional to the size of the grid
 
+    @param snek
+    Snake object in its starting position
+    @param seed Seed of the game, the same seed (and moves) always puts the food at the same tiles
+*/
+template<typename GridType>
+void BasicFood<GridType>::reset(const BasicSnake<GridType> & snek, std::uint64_t seed)
+{
+	rng = CounterRng(seed);
+	foodIndex = 0;
+	location = { grid.getWidth() / 2, grid.getHeight() / 2 };
+	hash = computeHash();
+	if (usesFreeTiles(grid)) {
+		freeTiles.fill();
+		for (const Vec2_<int>& segment : snek) {
+			freeTiles.erase(grid.toIndex(segment));
+		}
+	}
+	if (snek.isInTile(location)) {	// Center is covered by the snake on very low grids
+		respawn(snek);
+	}
 }
 
 /**
-    Returns the location of the food
+    Replaces the stream of the following respawns, the food stays where it is
+    Lets a search play out a copy of the game with food it can't know in advance (e.g. MCTS rollouts)
 
-    @return loc
+    @param seed Seed of the following respawns
 */
-Vec2_<int> Food::getLocation() const
+template<typename GridType>
+void BasicFood<GridType>::reseed(std::uint64_t seed)
 {
-	return location;
+	rng = CounterRng(seed);
+	foodIndex = 0;
 }
 
 /**
-    Resets the food's location back to the center of the screen (10, 5)
+    Relocates the food at a random tile not covered by the snake
+
+    @param snek Snake, after its last move
+    @return bool false if there is no free tile left (the snake fills the whole board), the location is kept in that case
 */
-void Food::reset()
+template<typename GridType>
+bool BasicFood<GridType>::respawn(const BasicSnake<GridType>& snek)
 {
-	location = { Board::Grid::WIDTH / 2, Board::Grid::HEIGHT / 2 };
+	const int nFree = grid.getCellCount() - snek.getLength();
+	if (nFree == 0) {
+		return false;
+	}
+	const int tile = pickTile(grid, snek.getOccupancy(), freeTiles, nFree, rng, foodIndex++);
+	hash ^= Zobrist::getKey(Zobrist::Food, grid.toIndex(location)) ^ Zobrist::getKey(Zobrist::Food, tile);
+	location = grid.toLocation(tile);
+	return true;
 }
-    
+
 /**
-    Relocates the food at a random location on the board avoiding the snake's body
+    Removes a tile from the free tiles, called when the snake's head enters it
 
-    @param snek
-    Snake object that needs to be avoided when placing food
+    @param tileLocation Location in Tile units
+*/
+template<typename GridType>
+void BasicFood<GridType>::markOccupied(const Vec2_<int>& tileLocation)
+{
+	if (usesFreeTiles(grid)) {
+		freeTiles.erase(grid.toIndex(tileLocation));
+	}
+}
+
+/**
+    Returns a tile to the free tiles, called as the snake's tail leaves it
+
+    @param tileLocation Location in Tile units
+*/
+template<typename GridType>
+void BasicFood<GridType>::markFree(const Vec2_<int>& tileLocation)
+{
+	if (usesFreeTiles(grid)) {
+		freeTiles.insert(grid.toIndex(tileLocation));
+	}
+}
+
+/**
+    Tells if food on the grid is picked from a maintained set of the free tiles
+    Grids of up to maxProbedCells tiles (the classic grid) probe the occupancy instead, so GameState stays small;
+    a runtime Grid decides by its size, so it places food like the FixedGrid of the same size
+
+    @param grid Grid the food is placed on
+    @return true if the free tiles are kept
+*/
+template<typename GridType>
+bool BasicFood<GridType>::usesFreeTiles(const GridType& grid)
+{
+	return HAS_FREE_TILES && grid.getCellCount() > maxProbedCells;
+}
+
+/**
+    Picks a random tile not covered by the snake, shared with the batch simulation
+    On large grids it is a member of the free tiles, so it takes the same time however long the snake is.
+    Small grids try a few random tiles first, which almost always finds a free one unless the snake covers most of the board,
+    then pick a random one of the free tiles, counting them a word of the occupancy at a time
+    The pick only depends on the seed, the food index and the snake's moves
+
+    @param grid Grid the food is placed on
+    @param occupancy Tiles covered by the snake
+    @param freeTiles Tiles not covered by the snake, only read if usesFreeTiles(grid)
+    @param nFree Number of tiles not covered by the snake, at least 1
+    @param rng Generator keyed by the game's seed
+    @param foodIndex Number of respawns since the game was reset, selects the block of the stream to use
+    @return index of the tile (see Grid::toIndex)
 */
-void Food::respawn(const Snake & snek)
+template<typename GridType>
+int BasicFood<GridType>::pickTile(const GridType& grid, const Bitboard<GridType::CELL_CAPACITY>& occupancy, const FreeTiles& freeTiles,
+	int nFree, const CounterRng& rng, std::uint64_t foodIndex)
 {
-	std::uniform_int_distribution<int> xDist(0, Board::Grid::WIDTH - 1);    //  Sets the distribution for the X location between 0 and 19
-	std::uniform_int_distribution<int> yDist(0, Board::Grid::HEIGHT - 1);   //  Sets the distribtuion for the Y location between 0 and 10
-                                                                            //  as the grid size is 20 * 11
-	
-	do {
-        //  Sets the food object's location to the newly generated location
-		location = { xDist(rng), yDist(rng) };
-        //  Generate a new location if the current location is where the snake is
-	} while (snek.isInTile(location) || snek.getNextHeadLocation() == location);
+	assert(nFree > 0);
+	if (usesFreeTiles(grid)) {
+		assert(freeTiles.size() == nFree);
+		return freeTiles[rng.below(foodIndex, nFree)];
+	}
+	const std::uint64_t block = foodIndex * (maxRandomProbes + 1);
+	for (int probe = 0; probe < maxRandomProbes; ++probe) {
+		const int index = rng.below(block + probe, grid.getCellCount());
+		if (!occupancy.test(index)) {
+			return index;
+		}
+	}
+	return occupancy.findClear(rng.below(block + maxRandomProbes, nFree), grid.getCellCount());
+}
+
+/**
+    Returns the seed of the food's random placement
 
+    @return seed
+*/
+template<typename GridType>
+std::uint64_t BasicFood<GridType>::getSeed() const
+{
+	return rng.getSeed();
 }
+
+/**
+    Returns the number of times the food has been respawned since the last reset
+
+    @return food index
+*/
+template<typename GridType>
+std::uint64_t BasicFood<GridType>::getFoodIndex() const
+{
+	return foodIndex;
+}
+
+/**
+    Returns the Zobrist hash of the food (see Zobrist.h), updated as the food respawns
+
+    @return hash of the location
+*/
+template<typename GridType>
+std::uint64_t BasicFood<GridType>::getHash() const
+{
+	return hash;
+}
+
+/**
+    Computes the Zobrist hash of the food from its location
+
+    @return hash of the location
+*/
+template<typename GridType>
+std::uint64_t BasicFood<GridType>::computeHash() const
+{
+	return Zobrist::getKey(Zobrist::Food, grid.toIndex(location));
+}
+
+template class BasicFood<Grid>;
+template class BasicFood<ClassicGrid>;
+template class BasicFood<MediumGrid>;
+template class BasicFood<LargeGrid>;
+template class BasicFood<HugeGrid>;
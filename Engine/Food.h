@@ -2,26 +2,53 @@
 Manages the food object
 
 @author: Benjamin Korady
-@version: 1.0   11/02/2017
+@version: 1.4   17/10/2026
 */
 
 #pragma once
 
 #include "Snake.h"
-#include "Board.h"
-#include <random>
+#include "Grid.h"
+#include "CellSet.h"
+#include "CounterRng.h"
+#include <cstdint>
+#include <type_traits>
 
-class Food {
+template<typename GridType>
+class BasicFood {
 public:
-	Food();
-	Food(Vec2_<int> tileLocation);
-	void draw(Board &brd) const;
+	static constexpr int maxProbedCells = 256;	// Grids up to this many tiles probe the occupancy, larger ones sample a set of the free tiles
+	static constexpr bool HAS_FREE_TILES = GridType::CELL_CAPACITY == DYNAMIC_CAPACITY || GridType::CELL_CAPACITY > maxProbedCells;
+	using FreeTiles = typename std::conditional<HAS_FREE_TILES, CellSet<GridType::CELL_CAPACITY>, EmptyCellSet>::type;
+
+public:
+	BasicFood(const GridType& grid = GridType(), std::uint64_t seed = 0);
+	BasicFood(const GridType& grid, Vec2_<int> tileLocation, std::uint64_t seed = 0);
 	Vec2_<int> getLocation() const;
-    void reset();
-	void respawn(const Snake & snek);
+    void reset(const BasicSnake<GridType>& snek, std::uint64_t seed);
+	void reseed(std::uint64_t seed);
+	std::uint64_t getSeed() const;
+	std::uint64_t getFoodIndex() const;
+	std::uint64_t getHash() const;
+	std::uint64_t computeHash() const;
+	bool respawn(const BasicSnake<GridType>& snek);
+	void markOccupied(const Vec2_<int>& tileLocation);
+	void markFree(const Vec2_<int>& tileLocation);
+	static bool usesFreeTiles(const GridType& grid);
+	static int pickTile(const GridType& grid, const Bitboard<GridType::CELL_CAPACITY>& occupancy, const FreeTiles& freeTiles,
+		int nFree, const CounterRng& rng, std::uint64_t foodIndex);
+
+private:
+	static constexpr int maxRandomProbes = 16;		// Random tiles tried before falling back to counting the free tiles
 
 private:
 	Vec2_<int> location;
-	std::mt19937 rng;
-	
-};
\ No newline at end of file
+	GridType grid;
+	FreeTiles freeTiles;			// Tiles not covered by the snake, kept in sync with its moves when usesFreeTiles(grid)
+	CounterRng rng;					// Keyed by the game's seed, the n-th respawn uses numbers from the n-th block of its stream
+	std::uint64_t foodIndex = 0;	// Number of respawns since the last reset
+	std::uint64_t hash;				// Zobrist key of the location, updated when the food moves
+};
+
+using Food = BasicFood<Grid>;
+using ClassicFood = BasicFood<ClassicGrid>;		// Food of the windowed game
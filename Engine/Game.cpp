@@ -33,17 +33,26 @@ Game::Game(MainWindow& wnd)
 	wnd(wnd),                       //  Window
 	gfx(wnd),                       //  Graphics
 	brd(gfx),                       //  Board
-	snek(),                         //  Snake
-	snekCache(),
-	nom(),                          //  Food
-	nomCache(),
-	menu(brd, snek, nom, wnd.kbd),  //  Menu
+	sim(ClassicGrid(), seedSource()),  //  Snake, Food and score
+	simCache(),
+	menu(brd, sim.getSnake(), sim.getFood(), wnd.kbd),  //  Menu
 	bgColor(172, 193, 0),            //  Green background color
-	saveFile("save\\gameSave.snek")
+	saveFile("save\\gameSave.snek"),
+	recorder("save\\replays.snekz", true, ReplayRecorder::Format::Packed)	// Records nothing if the file can't be opened, the game is played all the same
 {
 	loadGame();
 }
 
+/**
+	Ends the recording of the game being played
+*/
+Game::~Game()
+{
+	if (recorder.isRecording()) {
+		recorder.endGame(sim.getTick(), sim.getScore());
+	}
+}
+
 /**
 	Main game loop, this is looped indefinitely until the application has been closed
 */
@@ -75,7 +84,7 @@ void Game::UpdateModel()
 		updateGame();
 	} break;
 	case Menu::Item::Level: {
-		menu.navigateLevel(snek);
+		menu.navigateLevel(sim.getSnake());
 	} break;
 	case Menu::Item::Instructions:
 		menu.navigateInstructions();
@@ -99,7 +108,7 @@ void Game::ComposeFrame()
 		break;
 	case Menu::Item::NewGame:
 	case Menu::Item::Continue:
-		if (isGameOver) {
+		if (sim.isGameOver()) {
 			drawGameOver();
 		}
 		else {
@@ -110,10 +119,10 @@ void Game::ComposeFrame()
 		menu.drawInstructions();
 		break;
 	case Menu::Item::LastView:
-		menu.drawLastView(snekCache, nomCache);
+		menu.drawLastView(simCache.getSnake(), simCache.getFood());
 		break;
 	case Menu::Item::Level:
-		menu.drawLevel(snek);
+		menu.drawLevel(sim.getSnake());
 		break;
 	case Menu::Item::TopScore:
 		menu.drawTopScore(topScore);
@@ -137,8 +146,8 @@ void Game::drawBackground()
 void Game::drawGame()
 {
 	brd.draw();
-	snek.draw(brd);
-	nom.draw(brd);
+	brd.drawSnake(sim.getSnake());
+	brd.drawFood(sim.getFood());
 }
 
 /**
@@ -147,7 +156,8 @@ void Game::drawGame()
 void Game::drawGameOver()
 {	
 	Vec2_<int> defaultPos(3, 3);
-	brd.drawString(defaultPos, "Game over!\nYour score:\n" + std::to_string(score), false);
+	const std::string title = sim.isWon() ? "You win!" : "Game over!";
+	brd.drawString(defaultPos, title + "\nYour score:\n" + std::to_string(sim.getScore()), false);
 }
 
 /**
@@ -155,10 +165,11 @@ void Game::drawGameOver()
 */
 void Game::gameReset()
 {
-	isGameOver = false;
-	snek.reset();
-	nom.reset();
-	score = 0;
+	if (recorder.isRecording()) {	// New game started halfway through this one
+		recorder.endGame(sim.getTick(), sim.getScore());
+	}
+	sim.reset(seedSource());
+	autopilot.reset(sim);
 }
 
 /**
@@ -170,10 +181,10 @@ void Game::updateGame()
 	while (!wnd.kbd.KeyIsEmpty()) {
 		const Keyboard::Event e = wnd.kbd.ReadKey();
 		if (e.IsPress()) {
-			if (isGameOver) {
+			if (sim.isGameOver()) {
 				if (e.GetCode() == VK_ESCAPE || e.GetCode() == VK_RETURN) {
-					if (score > topScore) {
-						topScore = score;
+					if (sim.getScore() > topScore) {
+						topScore = sim.getScore();
 					}
 					saveGame();
 					menu.returnToMenu();
@@ -189,40 +200,97 @@ void Game::updateGame()
 					}
 					return;
 				}
-				snek.handleKeyPressEvent(e);
+				if (e.GetCode() == 'P') {
+					isAutopilotOn = !isAutopilotOn;		// Demo: the autopilot takes over / hands back the controls
+				}
+				else if (!isAutopilotOn) {
+					queueAction(readAction(e));
+				}
 			}
 
 		}
 	}
 
-	if (!isGameOver) {
+	if (!sim.isGameOver()) {
 		const auto now = std::chrono::steady_clock::now();								// Store current time
 
-		if (snek.isTurnToMove(now) && snek.getDirection() != Vec2_<int>(DIR_ZERO)) {	
-			Vec2_<int> nextLocation = snek.getNextHeadLocation();						// Check where snake is about to go in its next step
-			if (brd.isInsideBoard(nextLocation) && !snek.isInTile(nextLocation)) {		// Snake is not about to collide with the walls or its body
-				if (nextLocation == nom.getLocation()) { // Snake is about to eat food
-					snek.grow();
-					nom.respawn(snek);
-					score += snek.getSpeed();
-				}
-				snek.move(brd);
-			}
-			else { // Snake collides with a wall / body
-				isGameOver = true;
+		if (isTurnToMove(now) && isAutopilotOn) {
+			queueAction(autopilot.act(sim));	// The autopilot presses its key right before the move
+		}
+		if (isTurnToMove(now) && sim.getSnake().getDirection() != Vec2_<int>(DIR_ZERO)) {	
+			recorder.recordSpeed(sim.getTick(), sim.getSnake().getSpeed());	// The level may have been changed in the menu
+			sim.step();
+			if (sim.isGameOver()) {	// Snake collided with a wall / body, or filled the whole board
+				recorder.endGame(sim.getTick(), sim.getScore());
 				if (menu.hasItem(Menu::Item::Continue)) {
 					menu.removeItem(Menu::Item::Continue);
 				}
-				snekCache = snek;	// Store last snake and food to 
-				nomCache = nom;		// draw them in "Last view"
+				simCache = sim;	// Store last snake and food to draw them in "Last view"
 				if (!menu.hasItem(Menu::Item::LastView)) {
 					menu.addItem(Menu::Item::LastView);
 				}
 			}
+			else {
+				lastMoved = now;	// Timestamp when the snake last moved. The time of the next move will be based on this
+			}
 		}
 	}
 }
 
+/**
+    States whether or not the snake can move (Has enough time passed since the last movement?)
+    The required time idle is based on the snake's movement speed
+
+    @param now Current point in time
+    @return bool is it the snake's turn to move
+*/
+bool Game::isTurnToMove(std::chrono::steady_clock::time_point now) const
+{
+    std::chrono::duration<float> diff = now - lastMoved;
+    return diff.count() >= sim.getSnake().getMovePeriod();
+}
+
+/**
+    Maps a key press to a direction for the snake
+    Controls: Arrow Keys or WASD
+
+    @param e Key press event
+    @return Simulation::Action Action::None if the key doesn't control the snake
+*/
+Simulation::Action Game::readAction(const Keyboard::Event& e) const
+{
+	if (e.GetCode() == (VK_UP) || e.GetCode() == ('W')) {
+		return Simulation::Action::Up;
+	}
+	else if (e.GetCode() == (VK_LEFT) || e.GetCode() == ('A')) {
+		return Simulation::Action::Left;
+	}
+	else if (e.GetCode() == (VK_DOWN) || e.GetCode() == ('S')) {
+		return Simulation::Action::Down;
+	}
+	else if (e.GetCode() == (VK_RIGHT) || e.GetCode() == ('D')) {
+		return Simulation::Action::Right;
+	}
+	return Simulation::Action::None;
+}
+
+/**
+	Queues an action into the game and records it, the game's recording starts with its first action
+	(until then the speed level can still be changed)
+
+	@param action Action, Action::None is ignored
+*/
+void Game::queueAction(Simulation::Action action)
+{
+	if (action == Simulation::Action::None) {
+		return;
+	}
+	if (!recorder.isRecording()) {
+		recorder.beginGame(sim);
+	}
+	recorder.recordAction(sim.getTick(), action);
+	sim.queueAction(action);
+}
 
 /**
 	Saves the top score and last used speed level to a file
@@ -233,7 +301,7 @@ void Game::saveGame()
 	if (write.is_open()) {
 		std::string output = "topScore\n" + std::to_string(topScore);
 		write << output;
-		output = "\n\nlevel\n" + std::to_string(snek.getSpeed());
+		output = "\n\nlevel\n" + std::to_string(sim.getSnake().getSpeed());
 		write << output;
 	}
 }
@@ -252,7 +320,7 @@ void Game::loadGame()
 			else if (line == "level") {
 				int speedIn;
 				readFile >> speedIn;
-				snek.setSpeed(speedIn);
+				sim.getSnake().setSpeed(speedIn);
 			}
 			else if (line.empty()) {
 
@@ -42,6 +42,9 @@
 #include <random>
 #include "Food.h"
 #include "Menu.h"
+#include "Simulation.h"
+#include "HamiltonianBot.h"
+#include "ReplayRecorder.h"
 #include <string>
 #include <chrono>
 #include <fstream>
@@ -52,6 +55,7 @@ public:
 	Game( class MainWindow& wnd );
 	Game( const Game& ) = delete;
 	Game& operator=( const Game& ) = delete;
+	~Game();
 	void Go();
 
 private:
@@ -64,22 +68,28 @@ private:
     void drawGameOver();
     void gameReset();
     void updateGame();
+	bool isTurnToMove(std::chrono::steady_clock::time_point now) const;
+	Simulation::Action readAction(const Keyboard::Event& e) const;
+	void queueAction(Simulation::Action action);
 	void saveGame();
 	void loadGame();
 
 private:
-	bool isGameOver = false;
 	int topScore = 0;
-	int score = 0;
 
 	MainWindow& wnd;
 	Graphics gfx;
 	Board brd;
     Color bgColor;
-    Snake snek;
-    Snake snekCache;
-    Food nom;
-    Food nomCache;
+    std::random_device seedSource;	// Seeds every new game
+    GameState sim;			// Rules of the current game (snake, food, score)
+    GameState simCache;		// Last finished game, drawn in "Last view". A plain copy of sim, nothing is allocated
     Menu menu;
+    HamiltonianBot autopilot;		// Plays the demo, toggled with P during a game
+    bool isAutopilotOn = false;
+    std::chrono::steady_clock::time_point lastMoved = std::chrono::steady_clock::now();
+	// Stores point in time when snake last moved and uses this to determine if enough time has passed 
+	// for it to move again
 	std::string saveFile;
+	ReplayRecorder recorder;	// Every action queued into sim, range coded as it is played, so a game can be played again (see ReplayCodec)
 };
\ No newline at end of file
@@ -0,0 +1,236 @@
+#include "GeneticTuner.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <assert.h>
+
+namespace {
+	/**
+		Stream of random numbers for the genetic operators, read from a counter-based generator in order
+	*/
+	class Draws {
+	public:
+		Draws(std::uint64_t seed)
+			:
+			rng(seed)
+		{}
+		double uniform()	// In [0, 1)
+		{
+			return double(rng(counter++) >> 11) * (1.0 / 9007199254740992.0);
+		}
+		double normal()		// Standard normal, Box-Muller
+		{
+			const double u = 1.0 - uniform();	// In (0, 1], so the log is finite
+			const double v = uniform();
+			return std::sqrt(-2.0 * std::log(u)) * std::cos(6.283185307179586 * v);
+		}
+		int below(int bound)
+		{
+			return rng.below(counter++, bound);
+		}
+
+	private:
+		CounterRng rng;
+		std::uint64_t counter = 0;
+	};
+
+	constexpr std::uint64_t GAMES_STREAM = 0x6A3E5;		// Keeps the games' seeds apart from the genetic operators' numbers
+}
+
+/**
+	Constructs the tuner
+
+	@param grid Grid the games are played on
+*/
+template<typename GridType>
+BasicGeneticTuner<GridType>::BasicGeneticTuner(const GridType& grid)
+	:
+	grid(grid)
+{
+}
+
+/**
+	Evolves the weights for a number of generations
+	The first population holds the default weights and random ones with every weight in [0, 2)
+
+	@param settings Size of the population, games per candidate, genetic operators, threads and seed
+	@param onGeneration Called with every evaluated generation, e.g. to log it
+	@return weights of the best candidate of the last generation
+*/
+template<typename GridType>
+typename BasicGeneticTuner<GridType>::Weights BasicGeneticTuner<GridType>::run(const Settings& settings, const GenerationCallback& onGeneration) const
+{
+	assert(settings.population > 0 && settings.games > 0 && settings.generations > 0);
+	assert(settings.elites >= 0 && settings.elites <= settings.population && settings.tournamentSize > 0);
+	Draws draws(settings.seed);
+	const CounterRng gamesSeeds(settings.seed ^ GAMES_STREAM);
+
+	Generation generation;
+	generation.candidates.resize(settings.population);
+	for (int c = 1; c < settings.population; ++c) {
+		Weights& weights = generation.candidates[c];
+		weights.foodDistance = 2.0 * draws.uniform();
+		weights.freeArea = 2.0 * draws.uniform();
+		weights.tailReachable = 2.0 * draws.uniform();
+	}
+
+	std::vector<int> ranking(settings.population);
+	std::vector<Weights> next(settings.population);
+	for (int g = 0;; ++g) {
+		generation.index = g;
+		evaluate(settings, gamesSeeds(std::uint64_t(g)), generation);
+		std::iota(ranking.begin(), ranking.end(), 0);
+		std::stable_sort(ranking.begin(), ranking.end(), [&generation](int a, int b) {
+			return generation.meanFood[a] > generation.meanFood[b];
+		});
+		generation.best = ranking[0];
+		if (onGeneration) {
+			onGeneration(generation);
+		}
+		if (g + 1 == settings.generations) {
+			break;
+		}
+
+		const auto pickParent = [&]() {
+			int winner = draws.below(settings.population);
+			for (int i = 1; i < settings.tournamentSize; ++i) {
+				const int contender = draws.below(settings.population);
+				if (generation.meanFood[contender] > generation.meanFood[winner]) {
+					winner = contender;
+				}
+			}
+			return generation.candidates[winner];
+		};
+		const auto breed = [&](double a, double b) {	// Blend of the parents' genes, then maybe a mutation
+			double gene = a + draws.uniform() * (b - a);
+			if (draws.uniform() < settings.mutationRate) {
+				gene += settings.mutationScale * draws.normal();
+			}
+			return gene;
+		};
+		for (int c = 0; c < settings.elites; ++c) {
+			next[c] = generation.candidates[ranking[c]];
+		}
+		for (int c = settings.elites; c < settings.population; ++c) {
+			const Weights mother = pickParent();
+			const Weights father = pickParent();
+			next[c].foodDistance = breed(mother.foodDistance, father.foodDistance);
+			next[c].freeArea = breed(mother.freeArea, father.freeArea);
+			next[c].tailReachable = breed(mother.tailReachable, father.tailReachable);
+		}
+		generation.candidates.swap(next);
+	}
+	return generation.candidates[generation.best];
+}
+
+/**
+	Writes the column names of the log
+
+	@param out Stream of the log
+*/
+template<typename GridType>
+void BasicGeneticTuner<GridType>::writeCsvHeader(std::ostream& out)
+{
+	out << "generation,candidate,food_distance,free_area,tail_reachable,mean_food\n";
+}
+
+/**
+	Writes one row per candidate of a generation to the log and flushes it, so the log can be read while the tuner runs
+
+	@param out Stream of the log
+	@param generation Evaluated generation
+*/
+template<typename GridType>
+void BasicGeneticTuner<GridType>::writeCsv(std::ostream& out, const Generation& generation)
+{
+	for (int c = 0; c < int(generation.candidates.size()); ++c) {
+		const Weights& weights = generation.candidates[c];
+		out << generation.index << ',' << c << ',' << weights.foodDistance << ',' << weights.freeArea << ','
+			<< weights.tailReachable << ',' << generation.meanFood[c] << '\n';
+	}
+	out.flush();
+}
+
+/**
+	Plays the generation's games with every candidate on all cores and fills in their mean food
+
+	@param settings Games per candidate, threads and tick limit
+	@param gamesSeed Seed of the generation's games, game i is played with CounterRng(gamesSeed)(i) by every candidate
+	@param generation Candidates to evaluate, receives the results
+*/
+template<typename GridType>
+void BasicGeneticTuner<GridType>::evaluate(const Settings& settings, std::uint64_t gamesSeed, Generation& generation) const
+{
+	const int nCandidates = int(generation.candidates.size());
+	const std::uint64_t nItems = std::uint64_t(nCandidates) * settings.games;
+	int nThreads = settings.threads > 0 ? settings.threads : int(std::thread::hardware_concurrency());
+	nThreads = int(std::max<std::uint64_t>(1, std::min<std::uint64_t>(std::uint64_t(nThreads), nItems)));
+	const std::uint64_t maxTicksWithoutFood = settings.maxTicksWithoutFood > 0 ? settings.maxTicksWithoutFood : 4 * std::uint64_t(grid.getCellCount());
+
+	const CounterRng seeds(gamesSeed);
+	std::atomic<std::uint64_t> nextItem{ 0 };
+	std::vector<std::int64_t> food(nCandidates, 0);
+	std::uint64_t ticks = 0;
+	std::mutex merge;
+
+	const auto work = [&]() {
+		BasicSimulation<GridType> sim(grid);
+		sim.getSnake().setSpeed(1);		// Score is the number of food
+		BasicHeuristicBot<GridType> bot(grid);
+		std::vector<std::int64_t> localFood(nCandidates, 0);
+		std::uint64_t localTicks = 0;
+
+		for (std::uint64_t item = nextItem.fetch_add(1, std::memory_order_relaxed); item < nItems;
+			item = nextItem.fetch_add(1, std::memory_order_relaxed)) {
+			const int candidate = int(item / settings.games);
+			bot.setWeights(generation.candidates[candidate]);
+			sim.reset(seeds(item % settings.games));
+			bot.reset(sim);
+			std::uint64_t lastMeal = 0;
+			while (!sim.isGameOver() && sim.getTick() - lastMeal < maxTicksWithoutFood) {
+				if (sim.step(bot.act(sim)) == SimulationBase::Outcome::Ate) {
+					lastMeal = sim.getTick();
+				}
+			}
+			localFood[candidate] += sim.getScore();
+			localTicks += sim.getTick();
+		}
+
+		std::lock_guard<std::mutex> lock(merge);
+		for (int c = 0; c < nCandidates; ++c) {
+			food[c] += localFood[c];
+		}
+		ticks += localTicks;
+	};
+
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int t = 1; t < nThreads; ++t) {
+		threads.emplace_back(work);
+	}
+	work();
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	generation.meanFood.resize(nCandidates);
+	for (int c = 0; c < nCandidates; ++c) {
+		generation.meanFood[c] = double(food[c]) / settings.games;
+	}
+	generation.games = nItems;
+	generation.ticks = ticks;
+	generation.threads = nThreads;
+	generation.seconds = elapsed.count();
+}
+
+template class BasicGeneticTuner<Grid>;
+template class BasicGeneticTuner<ClassicGrid>;
+template class BasicGeneticTuner<MediumGrid>;
+template class BasicGeneticTuner<LargeGrid>;
+template class BasicGeneticTuner<HugeGrid>;
@@ -0,0 +1,69 @@
+/**
+	Genetic algorithm evolving the weights of the heuristic bot (see HeuristicBot) towards the most food eaten
+	Every generation plays the same games with every candidate: game i of a generation uses the same seed, hence the same
+	food stream, for all of them (common random numbers), so their results differ by their play rather than their luck.
+	Each generation draws new seeds, which keeps the population from fitting one set of games
+	The (candidate, game) pairs of a generation are handed out to every core one at a time, from a shared counter,
+	so a thread never waits while games are left; every thread sums its results locally and merges them once
+
+	The next generation keeps the best candidates (elites) and fills up with children of parents picked by tournament
+	selection, with blended genes and Gaussian mutations. Everything only depends on the seed, not on the number of threads
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "HeuristicBot.h"
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+template<typename GridType>
+class BasicGeneticTuner {
+public:
+	using Weights = typename BasicHeuristicBot<GridType>::Weights;
+
+	struct Settings {
+		int population = 200;
+		int games = 1000;						// Games per candidate and generation
+		int generations = 20;
+		int elites = 4;							// Best candidates copied to the next generation as they are
+		int tournamentSize = 3;					// Candidates drawn to pick each parent, the best of them wins
+		double mutationRate = 0.3;				// Chance of each gene of a child to mutate
+		double mutationScale = 0.25;			// Standard deviation of a mutation
+		int threads = 0;						// 0 uses every hardware thread
+		std::uint64_t seed = 1;
+		std::uint64_t maxTicksWithoutFood = 0;	// Games stop after this many ticks without eating (a bot going round in circles), 0 is 4 per tile
+	};
+
+	struct Generation {
+		int index = 0;
+		std::vector<Weights> candidates;
+		std::vector<double> meanFood;			// Per candidate, over the generation's games
+		int best = 0;							// Index of the candidate with the most food
+		std::uint64_t games = 0;
+		std::uint64_t ticks = 0;
+		int threads = 0;
+		double seconds = 0.0;					// Time spent playing the generation's games
+	};
+
+	using GenerationCallback = std::function<void(const Generation&)>;	// Called once each generation is evaluated
+
+public:
+	BasicGeneticTuner(const GridType& grid = GridType());
+	Weights run(const Settings& settings, const GenerationCallback& onGeneration) const;
+
+	static void writeCsvHeader(std::ostream& out);
+	static void writeCsv(std::ostream& out, const Generation& generation);
+
+private:
+	void evaluate(const Settings& settings, std::uint64_t gamesSeed, Generation& generation) const;
+
+private:
+	GridType grid;
+};
+
+using GeneticTuner = BasicGeneticTuner<ClassicGrid>;
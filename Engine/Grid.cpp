@@ -0,0 +1,93 @@
+#include "Grid.h"
+#include <assert.h>
+
+/**
+	Constructs the classic 20x11 grid
+*/
+Grid::Grid()
+	:
+	Grid(CLASSIC_WIDTH, CLASSIC_HEIGHT)
+{
+}
+
+/**
+	Constructs a grid of the given size
+
+	@param width Width in tiles, at least 2
+	@param height Height in tiles, at least 1
+*/
+Grid::Grid(int width, int height)
+	:
+	width(width),
+	height(height)
+{
+	assert(width >= 2);
+	assert(height >= 1);
+}
+
+/**
+	Checks if input location is inside the grid
+
+	@param tileLocation The location to check in Tile units
+	@return bool
+*/
+bool Grid::isInside(const Vec2_<int>& tileLocation) const
+{
+	return
+		tileLocation.x >= 0 &&
+		tileLocation.x < width &&
+		tileLocation.y >= 0 &&
+		tileLocation.y < height;
+}
+
+/**
+	Converts a tile location to its index in row-major order (used to address bitboards)
+
+	@param tileLocation Location inside the grid in Tile units
+	@return int index between 0 and getCellCount() - 1
+*/
+int Grid::toIndex(const Vec2_<int>& tileLocation) const
+{
+	return tileLocation.y * width + tileLocation.x;
+}
+
+/**
+	Converts a tile index back to its location
+
+	@param index Row-major index between 0 and getCellCount() - 1
+	@return location in Tile units
+*/
+Vec2_<int> Grid::toLocation(int index) const
+{
+	return { index % width, index / width };
+}
+
+/**
+	Returns the width of the grid
+
+	@return width in tiles
+*/
+int Grid::getWidth() const
+{
+	return width;
+}
+
+/**
+	Returns the height of the grid
+
+	@return height in tiles
+*/
+int Grid::getHeight() const
+{
+	return height;
+}
+
+/**
+	Returns the number of tiles of the grid
+
+	@return width * height
+*/
+int Grid::getCellCount() const
+{
+	return width * height;
+}
@@ -0,0 +1,79 @@
+/**
+	Describes the tile grid the game is played on.
+	Platform independent, so it is shared by the Board (drawing) and the Simulation (rules)
+
+	Grid has its size chosen at runtime. FixedGrid<W, H> has the same interface with the size as template parameters,
+	so bounds checks and index conversions become compile time constants and the collections sized by the grid
+	use std::array. The windowed game always uses the classic 20x11 grid
+
+	@author Benjamin Korady
+	@version 1.2	17/10/2026
+*/
+
+#pragma once
+
+#include "Vec2.h"
+#include "Storage.h"
+
+class Grid {
+public:
+	Grid();
+	Grid(int width, int height);
+
+	bool isInside(const Vec2_<int>& tileLocation) const;
+	int toIndex(const Vec2_<int>& tileLocation) const;
+	Vec2_<int> toLocation(int index) const;
+	int getWidth() const;
+	int getHeight() const;
+	int getCellCount() const;
+
+public:
+	static constexpr int CLASSIC_WIDTH = 20;	// tiles
+	static constexpr int CLASSIC_HEIGHT = 11;	// tiles
+	static constexpr int CELL_CAPACITY = DYNAMIC_CAPACITY;
+
+private:
+	int width;		// tiles
+	int height;		// tiles
+};
+
+template<int WIDTH, int HEIGHT>
+class FixedGrid {
+	static_assert(WIDTH >= 2 && HEIGHT >= 1, "Grid has to be at least 2x1 tiles");
+
+public:
+	constexpr bool isInside(const Vec2_<int>& tileLocation) const
+	{
+		// Unsigned comparison covers both < 0 and >= size
+		return unsigned(tileLocation.x) < unsigned(WIDTH) && unsigned(tileLocation.y) < unsigned(HEIGHT);
+	}
+	constexpr int toIndex(const Vec2_<int>& tileLocation) const
+	{
+		return tileLocation.y * WIDTH + tileLocation.x;
+	}
+	constexpr Vec2_<int> toLocation(int index) const
+	{
+		return { index % WIDTH, index / WIDTH };
+	}
+	constexpr int getWidth() const
+	{
+		return WIDTH;
+	}
+	constexpr int getHeight() const
+	{
+		return HEIGHT;
+	}
+	constexpr int getCellCount() const
+	{
+		return CELL_CAPACITY;
+	}
+
+public:
+	static constexpr int CELL_CAPACITY = WIDTH * HEIGHT;
+};
+
+// Grid sizes the simulation is compiled for, besides the runtime sized Grid
+using ClassicGrid = FixedGrid<Grid::CLASSIC_WIDTH, Grid::CLASSIC_HEIGHT>;
+using MediumGrid = FixedGrid<40, 22>;
+using LargeGrid = FixedGrid<64, 64>;
+using HugeGrid = FixedGrid<256, 256>;
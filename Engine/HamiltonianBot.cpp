@@ -0,0 +1,154 @@
+#include "HamiltonianBot.h"
+#include <algorithm>
+
+namespace {
+	const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };
+}
+
+/**
+	Constructs the bot, sharing the cycle tables of the grid size with the other bots
+
+	@param grid Grid of the games the bot plays, needs an even number of tiles
+*/
+template<typename GridType>
+BasicHamiltonianBot<GridType>::BasicHamiltonianBot(const GridType& grid)
+	:
+	grid(grid),
+	cycle(HamiltonianCycle::get(grid.getWidth(), grid.getHeight()))
+{
+}
+
+/**
+	Forgets the last game, the body is checked again before the first move
+
+	@param sim Game about to be played
+*/
+template<typename GridType>
+void BasicHamiltonianBot<GridType>::reset(const BasicSimulation<GridType>&)
+{
+	isOnCycle = false;
+	expectedHead = -1;
+}
+
+/**
+	Picks the next tile along the cycle, or a tile further along it next to the head (a shortcut) when
+		- the snake covers less than half of the board
+		- the shortcut doesn't skip the food
+		- after it, the free tiles between the head and the tail along the cycle outnumber the free tiles skipped
+	  so far (left behind the head) by SHORTCUT_MARGIN. Only eating shrinks that gap, while the tail catches up with
+	  the skipped tiles. The margin is a heuristic: eating more foods than there are tiles ahead before the tail
+	  gets the skipped ones back is unlikely but possible, and then the head runs into the tail
+	If the body isn't in cycle order (e.g. the autopilot takes over a game halfway), it makes safe moves until it is
+
+	@param sim Game to play
+	@return action
+*/
+template<typename GridType>
+SimulationBase::Action BasicHamiltonianBot<GridType>::act(const BasicSimulation<GridType>& sim)
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	const Vec2_<int> headLocation = snek.getHeadLocation();
+	const int head = grid.toIndex(headLocation);
+	if (!isOnCycle || head != expectedHead) {	// Someone else moved the snake
+		isOnCycle = isBodyInCycleOrder(snek);
+	}
+	if (!isOnCycle) {
+		expectedHead = -1;
+		return findSafeMove(snek);
+	}
+
+	// Positions along the cycle are counted from the tail, so the body covers [0, headPosition]
+	const int nTiles = cycle->getLength();
+	const int length = snek.getLength();
+	const int tail = grid.toIndex(snek.getTailLocation());
+	const int headPosition = getDistance(tail, head);
+	int target = cycle->getNext(head);
+	int targetPosition = headPosition + 1;
+
+	if (2 * length < nTiles) {
+		const int foodPosition = getDistance(tail, grid.toIndex(sim.getFood().getLocation()));
+		// Free tiles ahead minus free tiles behind after a shortcut to p: (nTiles - 1 - p) - (p - length) >= SHORTCUT_MARGIN
+		int limit = (nTiles - 1 + length - SHORTCUT_MARGIN) / 2;
+		if (foodPosition > headPosition) {
+			limit = std::min(limit, foodPosition);
+		}
+		for (const Vec2_<int>& step : STEPS) {
+			const Vec2_<int> next = headLocation + step;
+			if (!grid.isInside(next)) {
+				continue;
+			}
+			const int tile = grid.toIndex(next);
+			const int position = getDistance(tail, tile);
+			if (position > targetPosition && position <= limit) {
+				target = tile;
+				targetPosition = position;
+			}
+		}
+	}
+
+	expectedHead = target;
+	return SimulationBase::toAction(grid.toLocation(target) - headLocation);
+}
+
+/**
+	States whether or not the body's tiles come in cycle order, going from the tail to the head
+
+	@param snek Snake
+	@return bool
+*/
+template<typename GridType>
+bool BasicHamiltonianBot<GridType>::isBodyInCycleOrder(const BasicSnake<GridType>& snek) const
+{
+	const int tail = grid.toIndex(snek.getTailLocation());
+	int previous = cycle->getLength();
+	for (const Vec2_<int>& segment : snek) {	// Head to tail, so the positions have to go down
+		const int position = getDistance(tail, grid.toIndex(segment));
+		if (position >= previous) {
+			return false;
+		}
+		previous = position;
+	}
+	return true;
+}
+
+/**
+	Picks a move which doesn't collide, preferring the one along the cycle
+
+	@param snek Snake
+	@return action, Action::None if every move collides
+*/
+template<typename GridType>
+SimulationBase::Action BasicHamiltonianBot<GridType>::findSafeMove(const BasicSnake<GridType>& snek) const
+{
+	const Vec2_<int> head = snek.getHeadLocation();
+	const Vec2_<int> next = grid.toLocation(cycle->getNext(grid.toIndex(head)));
+	if (!snek.isInTile(next)) {
+		return SimulationBase::toAction(next - head);
+	}
+	for (const Vec2_<int>& step : STEPS) {
+		if (grid.isInside(head + step) && !snek.isInTile(head + step)) {
+			return SimulationBase::toAction(step);
+		}
+	}
+	return SimulationBase::Action::None;
+}
+
+/**
+	Returns the number of moves along the cycle from one tile to another
+
+	@param fromTile Tile index to start from
+	@param toTile Tile index to reach
+	@return distance, 0 to the cycle length - 1
+*/
+template<typename GridType>
+int BasicHamiltonianBot<GridType>::getDistance(int fromTile, int toTile) const
+{
+	const int distance = cycle->getOrder(toTile) - cycle->getOrder(fromTile);
+	return distance < 0 ? distance + cycle->getLength() : distance;
+}
+
+template class BasicHamiltonianBot<Grid>;
+template class BasicHamiltonianBot<ClassicGrid>;
+template class BasicHamiltonianBot<MediumGrid>;
+template class BasicHamiltonianBot<LargeGrid>;
+template class BasicHamiltonianBot<HugeGrid>;
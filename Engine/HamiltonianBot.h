@@ -0,0 +1,43 @@
+/**
+	Autopilot which follows a Hamiltonian cycle of the grid (see HamiltonianCycle). Without shortcuts it never runs
+	into itself and ends every game it starts on the cycle by filling the whole board
+	While the snake covers less than half of the board it cuts across the cycle towards the food, keeping the body's
+	tiles in cycle order from the tail to the head. Every tile after the head along the cycle up to the tail is then
+	free, and following the cycle is safe while one of them is left. The tiles a shortcut skips stay free behind the head
+	until the tail moves past them, and each food eaten meanwhile takes one of the tiles ahead. So shortcuts are
+	a heuristic, not a proof: they leave SHORTCUT_MARGIN more tiles ahead than were skipped (about half of the free
+	tiles), and the snake only dies if it eats that many foods, each on the cycle ahead of it, before its tail
+	gets the skipped tiles back. No shortcut is safe against food placed that way on purpose
+	Each decision looks at the head's 4 neighbours and a few table entries, so it costs the same as a step
+
+	@author Benjamin Korady
+	@version 1.1	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include "HamiltonianCycle.h"
+#include <memory>
+
+template<typename GridType>
+class BasicHamiltonianBot : public BasicBot<GridType> {
+public:
+	BasicHamiltonianBot(const GridType& grid = GridType());
+	void reset(const BasicSimulation<GridType>& sim) override;
+	SimulationBase::Action act(const BasicSimulation<GridType>& sim) override;
+
+private:
+	bool isBodyInCycleOrder(const BasicSnake<GridType>& snek) const;
+	SimulationBase::Action findSafeMove(const BasicSnake<GridType>& snek) const;
+	int getDistance(int fromTile, int toTile) const;
+
+private:
+	static constexpr int SHORTCUT_MARGIN = 8;	// Free tiles ahead a shortcut has to leave, on top of those skipped (a heuristic, see act)
+	GridType grid;
+	std::shared_ptr<const HamiltonianCycle> cycle;
+	bool isOnCycle = false;		// Body was last seen in cycle order
+	int expectedHead = -1;		// Tile the head moves to if the last action is played, -1 to check the body again
+};
+
+using HamiltonianBot = BasicHamiltonianBot<ClassicGrid>;
@@ -0,0 +1,109 @@
+#include "HamiltonianCycle.h"
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <assert.h>
+
+/**
+	Returns the cycle of a grid size, building it on the first request for that size
+	Safe to call from several threads
+
+	@param width Width of the grid in tiles
+	@param height Height of the grid in tiles
+	@return cycle, shared with every other caller asking for the same size
+*/
+std::shared_ptr<const HamiltonianCycle> HamiltonianCycle::get(int width, int height)
+{
+	static std::mutex mutex;
+	static std::map<std::pair<int, int>, std::shared_ptr<const HamiltonianCycle>> cycles;
+
+	std::lock_guard<std::mutex> lock(mutex);
+	std::shared_ptr<const HamiltonianCycle>& cycle = cycles[{ width, height }];
+	if (!cycle) {
+		cycle.reset(new HamiltonianCycle(width, height));
+	}
+	return cycle;
+}
+
+/**
+	Builds the tables of a grid size
+
+	@param width Width of the grid in tiles
+	@param height Height of the grid in tiles
+*/
+HamiltonianCycle::HamiltonianCycle(int width, int height)
+	:
+	order(std::size_t(width) * height),
+	next(std::size_t(width) * height)
+{
+	if (width < 2 || height < 2 || (width % 2 != 0 && height % 2 != 0)) {
+		throw std::runtime_error("Grid has no Hamiltonian cycle, it needs an even number of tiles and at least 2 rows and 2 columns");
+	}
+
+	// Tiles in cycle order, starting with the bottom left one
+	std::vector<std::int32_t> path;
+	path.reserve(order.size());
+	const auto add = [&](int x, int y) { path.push_back(y * width + x); };
+	const int bottom = height - 1;
+	for (int x = 0; x < width; ++x) {
+		add(x, bottom);
+	}
+	if (width % 2 == 0) {	// Columns from the right, alternately up and down the rows above the bottom one, ending next to the start
+		for (int x = width - 1; x >= 0; --x) {
+			const bool isUp = (width - 1 - x) % 2 == 0;
+			for (int i = 0; i < bottom; ++i) {
+				add(x, isUp ? bottom - 1 - i : i);
+			}
+		}
+	}
+	else {					// Rows from the bottom, alternately left and right of the left column, which leads back down
+		for (int y = bottom - 1; y >= 0; --y) {
+			const bool isLeft = (bottom - 1 - y) % 2 == 0;
+			for (int i = 0; i < width - 1; ++i) {
+				add(isLeft ? width - 1 - i : i + 1, y);
+			}
+		}
+		for (int y = 0; y < bottom; ++y) {
+			add(0, y);
+		}
+	}
+	assert(path.size() == order.size());
+
+	for (std::size_t i = 0; i < path.size(); ++i) {
+		order[path[i]] = std::int32_t(i);
+		next[path[i]] = path[(i + 1) % path.size()];
+	}
+}
+
+/**
+	Returns the position of a tile along the cycle
+
+	@param tile Tile index
+	@return position, 0 to getLength() - 1
+*/
+int HamiltonianCycle::getOrder(int tile) const
+{
+	return order[tile];
+}
+
+/**
+	Returns the tile which follows a tile along the cycle
+
+	@param tile Tile index
+	@return tile index
+*/
+int HamiltonianCycle::getNext(int tile) const
+{
+	return next[tile];
+}
+
+/**
+	Returns the number of tiles on the cycle, which is every tile of the grid
+
+	@return length
+*/
+int HamiltonianCycle::getLength() const
+{
+	return int(order.size());
+}
@@ -0,0 +1,34 @@
+/**
+	Closed path through every tile of a grid, moving one tile up / down / left / right at a time
+	Stored as two tables indexed by tile (see Grid::toIndex): the position of the tile along the cycle and the tile after it
+	The tables only depend on the grid size, so they are built once per size and shared by every user (see get)
+
+	The cycle runs left to right along the bottom row, then serpentines through the rest of the grid and comes back down
+	the left column. The snake starts on the bottom row facing right, so its body already follows the cycle
+	A cycle exists when the grid has an even number of tiles, and at least 2 rows and 2 columns
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class HamiltonianCycle {
+public:
+	static std::shared_ptr<const HamiltonianCycle> get(int width, int height);
+
+	int getOrder(int tile) const;
+	int getNext(int tile) const;
+	int getLength() const;
+
+private:
+	HamiltonianCycle(int width, int height);
+
+private:
+	std::vector<std::int32_t> order;	// Position of each tile along the cycle, the bottom left tile is 0
+	std::vector<std::int32_t> next;		// Tile which follows each tile
+};
@@ -0,0 +1,104 @@
+#include "HeuristicBot.h"
+#include <algorithm>
+
+namespace {
+	const SimulationBase::Action MOVES[4] = {
+		SimulationBase::Action::Up, SimulationBase::Action::Down, SimulationBase::Action::Left, SimulationBase::Action::Right
+	};
+}
+
+/**
+	Constructs the bot, allocating its search buffers for the grid
+
+	@param grid Grid of the games the bot plays
+	@param weights Weights of the terms
+*/
+template<typename GridType>
+BasicHeuristicBot<GridType>::BasicHeuristicBot(const GridType& grid, const Weights& weights)
+	:
+	grid(grid),
+	weights(weights),
+	distances(grid),
+	floodFill(grid),
+	lookahead(grid)
+{
+}
+
+/**
+	Searches the distances to the food of the new game
+
+	@param sim Game about to be played
+*/
+template<typename GridType>
+void BasicHeuristicBot<GridType>::reset(const BasicSimulation<GridType>& sim)
+{
+	distances.rebuild(sim);
+}
+
+/**
+	Tries every move on a copy of the game and picks the one with the highest weighted sum of terms
+
+	@param sim Game to play
+	@return action, Action::None if every move dies
+*/
+template<typename GridType>
+SimulationBase::Action BasicHeuristicBot<GridType>::act(const BasicSimulation<GridType>& sim)
+{
+	distances.update(sim);
+	const double cellCount = grid.getCellCount();
+	SimulationBase::Action best = SimulationBase::Action::None;
+	double bestValue = 0.0;
+	for (const SimulationBase::Action move : MOVES) {
+		const Vec2_<int> next = sim.getSnake().getHeadLocation() + SimulationBase::toDirection(move);
+		if (!grid.isInside(next) || sim.getSnake().isInTile(next)) {
+			continue;	// Also rules out turning back, which the snake would ignore
+		}
+		lookahead = sim;
+		const SimulationBase::Outcome outcome = lookahead.step(move);
+		if (outcome == SimulationBase::Outcome::Died) {
+			continue;
+		}
+		if (outcome == SimulationBase::Outcome::Won) {
+			return move;
+		}
+		const BasicSnake<GridType>& snek = lookahead.getSnake();
+		const int distance = outcome == SimulationBase::Outcome::Ate ? 0 : distances.getDistance(next);
+		const double closeness = distance == BasicDistanceField<GridType>::UNREACHABLE ? 0.0 : 1.0 - std::min(distance / cellCount, 1.0);
+		const double area = floodFill.countReachable(snek) / cellCount;
+		const double tail = floodFill.isTailReachable(snek) ? 1.0 : 0.0;
+		const double value = weights.foodDistance * closeness + weights.freeArea * area + weights.tailReachable * tail;
+		if (best == SimulationBase::Action::None || value > bestValue) {
+			best = move;
+			bestValue = value;
+		}
+	}
+	return best;
+}
+
+/**
+	Replaces the weights of the terms, e.g. between the games of different candidates
+
+	@param newWeights Weights
+*/
+template<typename GridType>
+void BasicHeuristicBot<GridType>::setWeights(const Weights& newWeights)
+{
+	weights = newWeights;
+}
+
+/**
+	Returns the weights of the terms
+
+	@return weights
+*/
+template<typename GridType>
+const typename BasicHeuristicBot<GridType>::Weights& BasicHeuristicBot<GridType>::getWeights() const
+{
+	return weights;
+}
+
+template class BasicHeuristicBot<Grid>;
+template class BasicHeuristicBot<ClassicGrid>;
+template class BasicHeuristicBot<MediumGrid>;
+template class BasicHeuristicBot<LargeGrid>;
+template class BasicHeuristicBot<HugeGrid>;
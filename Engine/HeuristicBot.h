@@ -0,0 +1,45 @@
+/**
+	Autopilot which scores each move with a weighted sum of three terms and plays the best one:
+		- closeness to the food: 1 - (distance from the move's tile to the food) / (number of tiles), 0 if walled off
+		- free area: tiles the head can still reach after the move, over the number of tiles
+		- tail reachability: 1 if the head can still reach the tail after the move (it can follow it and survive)
+	Each move is played on a copy of the game, so the terms see the exact rules' result; moves which die are never taken
+	The weights are meant to be tuned (see GeneticTuner), scaling all of them by the same positive factor changes nothing
+	The bot has no memory, so with some weights it goes round in circles next to the food forever: cap the game's ticks
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include "DistanceField.h"
+#include "FloodFill.h"
+
+template<typename GridType>
+class BasicHeuristicBot : public BasicBot<GridType> {
+public:
+	struct Weights {
+		double foodDistance = 1.0;
+		double freeArea = 1.0;
+		double tailReachable = 1.0;
+	};
+
+public:
+	BasicHeuristicBot(const GridType& grid = GridType(), const Weights& weights = Weights());
+	void reset(const BasicSimulation<GridType>& sim) override;
+	SimulationBase::Action act(const BasicSimulation<GridType>& sim) override;
+
+	void setWeights(const Weights& newWeights);
+	const Weights& getWeights() const;
+
+private:
+	GridType grid;
+	Weights weights;
+	BasicDistanceField<GridType> distances;
+	BasicFloodFill<GridType> floodFill;
+	BasicSimulation<GridType> lookahead;	// Copy of the game a move is tried on, kept so copies reuse its memory
+};
+
+using HeuristicBot = BasicHeuristicBot<ClassicGrid>;
@@ -0,0 +1,140 @@
+#include "MappedFile.h"
+#include <cstdint>
+#include <stdexcept>
+#ifdef _WIN32
+#include "ChiliWin.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+	Opens or creates a file and maps its first bytes, growing the file to that size if needed
+	Throws std::runtime_error if the file can't be opened or mapped
+
+	@param path Path of the file
+	@param size Number of bytes to map
+*/
+MappedFile::MappedFile(const std::string& path, std::size_t size)
+	:
+	size(size)
+{
+#ifdef _WIN32
+	file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, DWORD(std::uint64_t(size) >> 32), DWORD(size), nullptr);	// Grows the file
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+	data = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+	if (data == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+#else
+	file = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+	if (file < 0) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	struct stat status;
+	if (fstat(file, &status) != 0 || (std::size_t(status.st_size) < size && ftruncate(file, off_t(size)) != 0)) {
+		close(file);
+		throw std::runtime_error("Can't grow " + path);
+	}
+	data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	if (data == MAP_FAILED) {
+		close(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+#endif
+}
+
+/**
+	Maps a whole existing file for reading only, writing to its bytes is an error
+	Throws std::runtime_error if the file can't be opened or mapped, or is empty
+
+	@param path Path of the file
+*/
+MappedFile::MappedFile(const std::string& path)
+{
+#ifdef _WIN32
+	file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		CloseHandle(file);
+		throw std::runtime_error("Can't map the empty file " + path);
+	}
+	size = std::size_t(fileSize.QuadPart);
+	mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		CloseHandle(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+	data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (data == nullptr) {
+		CloseHandle(mapping);
+		CloseHandle(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+#else
+	file = open(path.c_str(), O_RDONLY);
+	if (file < 0) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	struct stat status;
+	if (fstat(file, &status) != 0 || status.st_size == 0) {
+		close(file);
+		throw std::runtime_error("Can't map the empty file " + path);
+	}
+	size = std::size_t(status.st_size);
+	data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+	if (data == MAP_FAILED) {
+		close(file);
+		throw std::runtime_error("Can't map " + path);
+	}
+#endif
+}
+
+/**
+	Unmaps and closes the file, the changes stay in it
+*/
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	CloseHandle(file);
+#else
+	munmap(data, size);
+	close(file);
+#endif
+}
+
+/**
+	Returns the mapped bytes
+
+	@return pointer to the first byte of the file
+*/
+void* MappedFile::getData() const
+{
+	return data;
+}
+
+/**
+	Returns the number of mapped bytes
+
+	@return size in bytes
+*/
+std::size_t MappedFile::getSize() const
+{
+	return size;
+}
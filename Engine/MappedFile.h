@@ -0,0 +1,36 @@
+/**
+	File mapped into memory, read and written in place: changes reach the file without explicit writes,
+	and a file written by one run is used as is by the next one
+	Bytes added when the file is created or grown are zero. An existing file can also be mapped read only, whole
+	Uses mmap on POSIX systems and a file mapping on Windows
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+public:
+	MappedFile(const std::string& path, std::size_t size);
+	explicit MappedFile(const std::string& path);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+	~MappedFile();
+
+	void* getData() const;
+	std::size_t getSize() const;
+
+private:
+	void* data = nullptr;
+	std::size_t size;
+#ifdef _WIN32
+	void* file = nullptr;		// Handles of the file and of its mapping
+	void* mapping = nullptr;
+#else
+	int file = -1;
+#endif
+};
@@ -0,0 +1,355 @@
+#include "MctsBot.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <stdlib.h>
+#include <assert.h>
+
+template<typename GridType>
+constexpr double BasicMctsBot<GridType>::MAX_TIME_BUDGET;
+
+namespace {
+	const SimulationBase::Action MOVES[4] = {
+		SimulationBase::Action::Up, SimulationBase::Action::Down, SimulationBase::Action::Left, SimulationBase::Action::Right
+	};
+	const Vec2_<int> STEPS[4] = { { DIR_UP }, { DIR_DOWN }, { DIR_LEFT }, { DIR_RIGHT } };	// Directions of MOVES
+
+	constexpr float FOOD_DISCOUNT = 0.95f;	// Food eaten a tick later is worth this much of it
+
+	/**
+		Value of a playout between 0 and 1: the more food eaten and the sooner, the higher (food is the sum of
+		FOOD_DISCOUNT^tick), on top of 0.5 for surviving or a little for each tick lived before dying
+		Food eaten before a death still counts, as the random playouts die much more often than the bot would
+	*/
+	float evaluate(bool isDead, int nTicks, int horizon, float food)
+	{
+		const float eaten = 0.5f * food / (food + 1.0f);
+		if (isDead) {
+			return 0.1f * float(nTicks) / float(horizon) + eaten;
+		}
+		return 0.5f + eaten;
+	}
+}
+
+/**
+	Constructs the bot, the node arenas of its threads and starts the threads, which wait for a move to search
+	Settings out of range are clamped: the time budget to MAX_TIME_BUDGET (a move can't take longer than the fastest
+	move period), the node capacity to a root and its children
+
+	@param settings Threads, time budget, limits and seed of the search
+	@param grid Grid of the games the bot plays
+*/
+template<typename GridType>
+BasicMctsBot<GridType>::BasicMctsBot(const Settings& settings, const GridType& grid)
+	:
+	settings(settings),
+	grid(grid)
+{
+	this->settings.timeBudget = settings.timeBudget > 0.0 ? std::min(settings.timeBudget, MAX_TIME_BUDGET) : 0.0;
+	this->settings.nodeCapacity = std::max(settings.nodeCapacity, 5);
+	this->settings.playoutDepth = std::max(settings.playoutDepth, 0);
+	const int nThreads = settings.threads > 0 ? settings.threads : std::max(1, int(std::thread::hardware_concurrency()));
+	workers.reserve(nThreads);
+	for (int t = 0; t < nThreads; ++t) {
+		workers.emplace_back(this->settings.nodeCapacity);
+		workers.back().path.reserve(256);
+	}
+	helpers.reserve(nThreads - 1);
+	for (int t = 1; t < nThreads; ++t) {
+		helpers.emplace_back(&BasicMctsBot::helperLoop, this, t);
+	}
+}
+
+/**
+	Stops the threads
+*/
+template<typename GridType>
+BasicMctsBot<GridType>::~BasicMctsBot()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	wake.notify_all();
+	for (std::thread& helper : helpers) {
+		helper.join();
+	}
+}
+
+/**
+	Searches the game until the time budget (or the iteration limit) is used up and picks the move
+	whose subtree was visited the most, over all of the trees
+
+	@param sim Game to play
+	@return action
+*/
+template<typename GridType>
+SimulationBase::Action BasicMctsBot<GridType>::act(const BasicSimulation<GridType>& sim)
+{
+	const auto until = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+		std::chrono::duration<double>(settings.timeBudget));
+	if (!helpers.empty()) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			root = &sim;
+			deadline = until;
+			++searches;
+			nSearching = int(helpers.size());
+		}
+		wake.notify_all();
+	}
+	search(workers[0], 0, sim, until);
+	if (!helpers.empty()) {
+		std::unique_lock<std::mutex> lock(mutex);
+		done.wait(lock, [this]() { return nSearching == 0; });
+		root = nullptr;
+	}
+
+	// Root of every tree is node 0, its children hold the first moves
+	std::uint64_t visits[5] = {};
+	float values[5] = {};
+	for (Worker& worker : workers) {
+		const Node& root = worker.arena[0];
+		for (int c = 0; c < root.nChildren; ++c) {
+			const Node& child = worker.arena[root.firstChild + c];
+			visits[int(child.action)] += child.visits;
+			values[int(child.action)] += child.totalValue;
+		}
+	}
+	int best = -1;
+	for (int a = 1; a < 5; ++a) {
+		if (visits[a] > 0 && (best < 0 || visits[a] > visits[best] || (visits[a] == visits[best] && values[a] > values[best]))) {
+			best = a;
+		}
+	}
+	return best < 0 ? findSafeMove(sim) : SimulationBase::Action(best);
+}
+
+/**
+	Body of a helper thread: waits for a search to start, grows its tree until the search's deadline, then tells
+	act once it is the last one done
+
+	@param thread Index of the thread, its worker
+*/
+template<typename GridType>
+void BasicMctsBot<GridType>::helperLoop(int thread)
+{
+	std::uint64_t joined = 0;
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		wake.wait(lock, [this, joined]() { return isStopping || searches != joined; });
+		if (isStopping) {
+			return;
+		}
+		joined = searches;
+		const BasicSimulation<GridType>& game = *root;
+		const auto until = deadline;
+		lock.unlock();
+		search(workers[thread], thread, game, until);
+		lock.lock();
+		if (--nSearching == 0) {
+			done.notify_one();
+		}
+	}
+}
+
+/**
+	Grows one tree: every iteration copies the game, reseeds its food, follows the tree (UCT) to a leaf,
+	adds the leaf's children, plays out from there and adds the value to the nodes on the way
+
+	@param worker Arena and buffers of the thread
+	@param thread Index of the thread, selects its stream of seeds
+	@param root Current game
+	@param deadline Point in time at which to stop
+*/
+template<typename GridType>
+void BasicMctsBot<GridType>::search(Worker& worker, int thread, const BasicSimulation<GridType>& root,
+	std::chrono::steady_clock::time_point deadline) const
+{
+	Arena& arena = worker.arena;
+	arena.reset();
+	arena.allocate(1);
+
+	// Seeds of the playouts depend on the bot, the game, the tick and the thread, not on the time taken
+	const CounterRng seeds(CounterRng::mix(settings.seed ^ CounterRng::mix(root.getSeed() + root.getTick())) + std::uint64_t(thread));
+	const int horizon = settings.playoutDepth + 1;
+	for (std::uint64_t iteration = 0; ; ++iteration) {
+		if (settings.maxIterations > 0 && iteration >= std::uint64_t(settings.maxIterations)) {
+			break;
+		}
+		if ((iteration & 15) == 0 && std::chrono::steady_clock::now() >= deadline) {
+			break;
+		}
+
+		const std::uint64_t seed = seeds(iteration);
+		BasicSimulation<GridType> sim = root;
+		sim.getFood().reseed(seed);
+		worker.path.clear();
+		worker.path.push_back(0);
+
+		// Down the tree
+		std::int32_t node = 0;
+		float food = 0.0f;
+		float discount = 1.0f;
+		int nTicks = 0;
+		bool isOver = sim.isGameOver();
+		while (!isOver && arena[node].nChildren > 0) {
+			node = select(arena, arena[node]);
+			worker.path.push_back(node);
+			const SimulationBase::Outcome outcome = sim.step(arena[node].action);
+			++nTicks;
+			food += outcome == SimulationBase::Outcome::Ate || outcome == SimulationBase::Outcome::Won ? discount : 0.0f;
+			discount *= FOOD_DISCOUNT;
+			isOver = sim.isGameOver();
+		}
+		if (!isOver) {
+			expand(arena, node, sim);
+			if (arena[node].nChildren > 0) {
+				node = arena[node].firstChild;
+				worker.path.push_back(node);
+				const SimulationBase::Outcome outcome = sim.step(arena[node].action);
+				++nTicks;
+				food += outcome == SimulationBase::Outcome::Ate || outcome == SimulationBase::Outcome::Won ? discount : 0.0f;
+				discount *= FOOD_DISCOUNT;
+			}
+		}
+
+		const float value = sim.isGameOver() ? evaluate(!sim.isWon(), nTicks, nTicks + horizon, food) :
+			playOut(sim, food, discount, nTicks, CounterRng(CounterRng::mix(seed)));
+		for (const std::int32_t visited : worker.path) {
+			++arena[visited].visits;
+			arena[visited].totalValue += value;
+		}
+	}
+}
+
+/**
+	Picks the child to follow: an unvisited one if there is any, otherwise the one with the best UCT score
+
+	@param arena Nodes of the tree
+	@param parent Node to pick a child of, has children
+	@return index of the child
+*/
+template<typename GridType>
+std::int32_t BasicMctsBot<GridType>::select(Arena& arena, const Node& parent) const
+{
+	const float logVisits = std::log(float(parent.visits));
+	std::int32_t best = parent.firstChild;
+	float bestScore = -1.0f;
+	for (int c = 0; c < parent.nChildren; ++c) {
+		const std::int32_t index = parent.firstChild + c;
+		const Node& child = arena[index];
+		if (child.visits == 0) {
+			return index;
+		}
+		const float score = child.totalValue / float(child.visits) + settings.exploration * std::sqrt(logVisits / float(child.visits));
+		if (score > bestScore) {
+			best = index;
+			bestScore = score;
+		}
+	}
+	return best;
+}
+
+/**
+	Adds a child for every move of the snake but the one turning back into itself, if the arena has room for them
+
+	@param arena Nodes of the tree
+	@param node Leaf to expand
+	@param sim Game at the leaf
+*/
+template<typename GridType>
+void BasicMctsBot<GridType>::expand(Arena& arena, std::int32_t node, const BasicSimulation<GridType>& sim) const
+{
+	const Vec2_<int> direction = sim.getSnake().getDirection();
+	const int nMoves = direction == Vec2_<int>(DIR_ZERO) ? 4 : 3;
+	const std::int32_t first = arena.allocate(nMoves);
+	if (first < 0) {
+		return;		// Tree is full, the leaf keeps being played out
+	}
+	int c = 0;
+	for (int m = 0; m < 4; ++m) {
+		if (STEPS[m] != -direction || direction == Vec2_<int>(DIR_ZERO)) {
+			arena[first + c++].action = MOVES[m];
+		}
+	}
+	arena[node].firstChild = first;
+	arena[node].nChildren = std::uint8_t(nMoves);
+}
+
+/**
+	Plays the game on for at most playoutDepth ticks: every tick a random move which doesn't collide right away,
+	half of the time the one getting closer to the food if there is one
+
+	@param sim Copy of the game, played on
+	@param food Discounted food eaten on the way from the root
+	@param discount Discount of the next tick
+	@param nTicks Ticks played on the way from the root
+	@param rng Stream of the playout's random choices
+	@return value of the playout (see evaluate)
+*/
+template<typename GridType>
+float BasicMctsBot<GridType>::playOut(BasicSimulation<GridType>& sim, float food, float discount, int nTicks, const CounterRng& rng) const
+{
+	const int horizon = nTicks + settings.playoutDepth;
+	for (int tick = 0; tick < settings.playoutDepth; ++tick) {
+		const BasicSnake<GridType>& snek = sim.getSnake();
+		const Vec2_<int> head = snek.getHeadLocation();
+		const Vec2_<int> target = sim.getFood().getLocation();
+		const std::uint64_t bits = rng(std::uint64_t(tick));
+
+		int safe[4];
+		int nSafe = 0;
+		int closer = -1;
+		for (int m = 0; m < 4; ++m) {
+			const Vec2_<int> next = head + STEPS[m];
+			if (STEPS[m] == -snek.getDirection() || !grid.isInside(next) || snek.isInTile(next)) {
+				continue;
+			}
+			safe[nSafe++] = m;
+			if (abs(next.x - target.x) + abs(next.y - target.y) < abs(head.x - target.x) + abs(head.y - target.y)) {
+				closer = m;
+			}
+		}
+		SimulationBase::Action action = SimulationBase::Action::None;	// Trapped, the step ends the game
+		if (closer >= 0 && (bits & 1)) {
+			action = MOVES[closer];
+		}
+		else if (nSafe > 0) {
+			action = MOVES[safe[((bits >> 1) & 0xffffffff) * std::uint64_t(nSafe) >> 32]];
+		}
+
+		const SimulationBase::Outcome outcome = sim.step(action);
+		++nTicks;
+		food += outcome == SimulationBase::Outcome::Ate || outcome == SimulationBase::Outcome::Won ? discount : 0.0f;
+		discount *= FOOD_DISCOUNT;
+		if (sim.isGameOver()) {
+			return evaluate(!sim.isWon(), nTicks, horizon, food);
+		}
+	}
+	return evaluate(false, nTicks, horizon, food);
+}
+
+/**
+	Picks a move which doesn't collide, used when the search had no time for a single playout
+
+	@param sim Game to play
+	@return action, Action::None if every move collides
+*/
+template<typename GridType>
+SimulationBase::Action BasicMctsBot<GridType>::findSafeMove(const BasicSimulation<GridType>& sim) const
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	for (int m = 0; m < 4; ++m) {
+		const Vec2_<int> next = snek.getHeadLocation() + STEPS[m];
+		if (STEPS[m] != -snek.getDirection() && grid.isInside(next) && !snek.isInTile(next)) {
+			return MOVES[m];
+		}
+	}
+	return SimulationBase::Action::None;
+}
+
+template class BasicMctsBot<ClassicGrid>;
+template class BasicMctsBot<MediumGrid>;
+template class BasicMctsBot<LargeGrid>;
+template class BasicMctsBot<HugeGrid>;
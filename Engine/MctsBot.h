@@ -0,0 +1,127 @@
+/**
+	Autopilot which picks its moves with Monte Carlo tree search: it plays out many possible futures of the game from
+	plain copies of the simulation, and takes the move whose futures went best
+	Root-parallel: every thread grows its own tree from the current position, the visits of the first moves are
+	added up at the end. The food of the future is unknown, so each playout reseeds the food of its copy with its
+	own seed (see BasicFood::reseed); the tree is keyed by moves only (open loop), whatever food comes
+	Nodes come from one arena per thread, allocated on construction and emptied before every move, and the threads
+	are started on construction and woken up for every move: a move neither allocates nor starts a thread
+
+	Compiled for the FixedGrid presets only, whose simulations are copied without allocating
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include "CounterRng.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+template<typename GridType>
+class BasicMctsBot : public BasicBot<GridType> {
+public:
+	struct Settings {
+		int threads = 0;				// Trees searched side by side, 0 uses every hardware thread
+		double timeBudget = 0.05;		// Seconds per move, clamped to MAX_TIME_BUDGET
+		int maxIterations = 0;			// Playouts per tree and move, 0 leaves only the time budget. With a limit and no
+										// deadline hit, the moves only depend on the seeds
+		int playoutDepth = 40;			// Ticks played past the tree
+		int nodeCapacity = 1 << 16;		// Nodes per tree; a full tree keeps playing out from its leaves
+		float exploration = 0.7f;		// Weight of the UCT exploration term
+		std::uint64_t seed = 1;
+	};
+
+public:
+	BasicMctsBot(const Settings& settings = Settings(), const GridType& grid = GridType());
+	BasicMctsBot(const BasicMctsBot&) = delete;
+	BasicMctsBot& operator=(const BasicMctsBot&) = delete;
+	~BasicMctsBot();
+	SimulationBase::Action act(const BasicSimulation<GridType>& sim) override;
+
+public:
+	static constexpr double MAX_TIME_BUDGET = 5.0 / 60.0;	// Move period of the fastest speed level, in seconds
+
+private:
+	struct Node {
+		std::uint32_t visits = 0;
+		float totalValue = 0.0f;
+		std::int32_t firstChild = -1;	// Children are stored next to each other in the arena
+		std::uint8_t nChildren = 0;
+		SimulationBase::Action action = SimulationBase::Action::None;	// Move which leads to the node
+	};
+
+	/**
+		Fixed block of nodes handed out in order and given back all at once
+	*/
+	class Arena {
+	public:
+		Arena(int capacity)
+			:
+			nodes(capacity)
+		{}
+		std::int32_t allocate(int count)	// Index of the first of count new nodes, -1 if the arena is full
+		{
+			if (used + count > int(nodes.size())) {
+				return -1;
+			}
+			const std::int32_t first = used;
+			for (int i = 0; i < count; ++i) {
+				nodes[used++] = Node();
+			}
+			return first;
+		}
+		void reset()
+		{
+			used = 0;
+		}
+		Node& operator[](std::int32_t index)
+		{
+			return nodes[index];
+		}
+
+	private:
+		std::vector<Node> nodes;
+		int used = 0;
+	};
+
+	struct Worker {
+		Worker(int nodeCapacity)
+			:
+			arena(nodeCapacity)
+		{}
+		Arena arena;
+		std::vector<std::int32_t> path;		// Nodes from the root to the one being expanded
+	};
+
+private:
+	void helperLoop(int thread);
+	void search(Worker& worker, int thread, const BasicSimulation<GridType>& root, std::chrono::steady_clock::time_point deadline) const;
+	std::int32_t select(Arena& arena, const Node& parent) const;
+	void expand(Arena& arena, std::int32_t node, const BasicSimulation<GridType>& sim) const;
+	float playOut(BasicSimulation<GridType>& sim, float food, float discount, int nTicks, const CounterRng& rng) const;
+	SimulationBase::Action findSafeMove(const BasicSimulation<GridType>& sim) const;
+
+private:
+	Settings settings;
+	GridType grid;
+	std::vector<Worker> workers;	// One per thread, the first one is the calling thread's
+
+	std::mutex mutex;				// Guards the members below
+	std::condition_variable wake;	// A search starts, or the helpers stop
+	std::condition_variable done;	// The last helper finished its search
+	const BasicSimulation<GridType>* root = nullptr;	// Game searched, valid during act
+	std::chrono::steady_clock::time_point deadline;
+	std::uint64_t searches = 0;		// Searches started, a helper joins each one once
+	int nSearching = 0;				// Helpers still searching
+	bool isStopping = false;
+	std::vector<std::thread> helpers;	// Threads 1 and up, started last, once the members they use are constructed
+};
+
+using MctsBot = BasicMctsBot<ClassicGrid>;
@@ -12,7 +12,7 @@
 	@param nom
 	@param kbd
 */
-Menu::Menu(Board &brd, Snake &snek, Food &nom, Keyboard &kbd)
+Menu::Menu(Board &brd, ClassicSnake &snek, ClassicFood &nom, Keyboard &kbd)
     :
     brd(brd),
     snek(snek),
@@ -150,7 +150,7 @@ void Menu::navigateInstructions()
 
 	@param snek Snake of which the speed is to be altered
 */
-void Menu::navigateLevel(Snake & snek)
+void Menu::navigateLevel(ClassicSnake & snek)
 {
 	while (!kbd.KeyIsEmpty()) {
 		const Keyboard::Event e = kbd.ReadKey();
@@ -291,11 +291,11 @@ void Menu::drawTopScore(int topScore) const
 	@param snekCache Cached snake object from the last game
 	@param nomCache Cached food object from the last game
 */
-void Menu::drawLastView(const Snake& snekCache, const Food& nomCache) const
+void Menu::drawLastView(const ClassicSnake& snekCache, const ClassicFood& nomCache) const
 {
     brd.draw();
-    snekCache.draw(brd);
-    nomCache.draw(brd);
+    brd.drawSnake(snekCache);
+    brd.drawFood(nomCache);
 }
 
 /**
@@ -322,7 +322,7 @@ void Menu::drawInstructions() const
 	@param snek Snake object of which the current speed level is read from
 */
 
-void Menu::drawLevel(Snake& snek) const
+void Menu::drawLevel(ClassicSnake& snek) const
 {
     brd.drawString({ LINE_START_X, LINE_START_Y }, "Level:", false);
 
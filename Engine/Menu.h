@@ -28,7 +28,7 @@ public:
 	};
 
 public:
-    Menu(Board &brd, Snake &snek, Food &nom, Keyboard &kbd);
+    Menu(Board &brd, ClassicSnake &snek, ClassicFood &nom, Keyboard &kbd);
 
 	Item getSelectedItem() const;
 	bool hasItem(Item item) const;
@@ -40,13 +40,13 @@ public:
 
 	void draw() const;
 	void drawTopScore(int topScore) const;
-	void drawLastView(const Snake& snekCache, const Food& nomCache) const;
+	void drawLastView(const ClassicSnake& snekCache, const ClassicFood& nomCache) const;
 	void drawInstructions() const;
-	void drawLevel(Snake& snek) const;
+	void drawLevel(ClassicSnake& snek) const;
 
 	void navigate();
 	void navigateInstructions();
-	void navigateLevel(Snake& snek);
+	void navigateLevel(ClassicSnake& snek);
 
 private:
 	void drawItemName(Item itemIn, int position, bool selected) const;
@@ -66,8 +66,8 @@ private:
     int scrollbarPos = 0;
 
     Keyboard& kbd;
-    Food& nom;
-    Snake& snek;
+    ClassicFood& nom;
+    ClassicSnake& snek;
     Board& brd;
 
 // General values
@@ -83,7 +83,7 @@ private:
 
 // Instructions specific values
 private:
-	const std::string instructions = "Make the snake grow longer by directing it to the food. Use the arrow keys or W, A, S, and D. You cannot stop the snake or make it go backwards. Try not to hit the walls or the tail.\n";
+	const std::string instructions = "Make the snake grow longer by directing it to the food. Use the arrow keys or W, A, S, and D. You cannot stop the snake or make it go backwards. Try not to hit the walls or the tail. Press P to let the autopilot play.\n";
 	const std::vector<std::string> instructionsLines = LetterMap::splitStringByLimit(instructions, brd.LP_WIDTH - RIGHT_SIDE_OFFSET, Board::LETTER_SPACING); // Split the instructions into lines that fit on the screen
 	static constexpr int MAX_LINES_ON_SCREEN = 4;
 	const int MAX_INSTRUCTIONS_SCROLLBAR_POS = (int)instructionsLines.size() - 1;
@@ -0,0 +1,187 @@
+#include "NpyWriter.h"
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <assert.h>
+
+constexpr std::size_t NpyWriter::ALIGNMENT;
+
+namespace {
+	const char MAGIC[] = "\x93NUMPY";
+	constexpr std::size_t PREAMBLE_SIZE = 10;	// Magic, version and the header's length
+}
+
+/**
+	Opens the column's file: creates it with no rows, or reads the row count of an existing one to append to it
+	Throws std::runtime_error if the file can't be opened, or if the file appended to holds another type or shape
+
+	@param path File to write
+	@param type NumPy type string of a value, its item size is the number at its end (e.g. 4 for "<f4")
+	@param rowShape Values per row along each dimension, empty for one value per row
+	@param chunkRows Rows gathered before they are written
+	@param appends true to add rows to an existing file, false to replace it
+*/
+NpyWriter::NpyWriter(const std::string& path, const std::string& type, const std::vector<std::uint64_t>& rowShape,
+	std::size_t chunkRows, bool appends)
+	:
+	path(path),
+	type(type),
+	rowShape(rowShape),
+	chunkRows(chunkRows)
+{
+	assert(chunkRows > 0 && type.size() >= 3);
+	rowSize = std::size_t(std::strtoul(type.c_str() + 2, nullptr, 10));
+	for (std::uint64_t dimension : rowShape) {
+		rowSize *= std::size_t(dimension);
+	}
+	headerSize = makeHeader(std::numeric_limits<std::uint64_t>::max()).size();	// Largest row count, the longest header
+	chunk.reserve(chunkRows * rowSize);
+
+	if (appends) {
+		file.open(path, std::ios::in | std::ios::out | std::ios::binary);
+	}
+	if (file.is_open()) {
+		std::string header(headerSize, '\0');
+		file.read(&header[0], std::streamsize(headerSize));
+		const std::size_t shape = header.find("'shape': (");
+		const std::uint64_t rows = shape == std::string::npos ? 0 : std::strtoull(header.c_str() + shape + 10, nullptr, 10);
+		if (!file || header != makeHeader(rows)) {
+			throw std::runtime_error(path + " doesn't hold a column of type " + type + " with the same shape");
+		}
+		writtenRows = rows;
+	}
+	else {
+		file.open(path, std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("Can't open " + path);
+		}
+		const std::string header = makeHeader(0);
+		file.write(header.data(), std::streamsize(header.size()));
+	}
+	file.seekp(std::streamoff(headerSize + writtenRows * rowSize));
+}
+
+/**
+	Writes the rows still gathered, a failure is ignored: call flush first to find out about it
+*/
+NpyWriter::~NpyWriter()
+{
+	try {
+		flush();
+	}
+	catch (const std::runtime_error&) {
+	}
+}
+
+/**
+	Adds a row, writing the chunk out if it is full
+
+	@param row getRowSize() bytes
+*/
+void NpyWriter::append(const void* row)
+{
+	const std::uint8_t* const bytes = static_cast<const std::uint8_t*>(row);
+	chunk.insert(chunk.end(), bytes, bytes + rowSize);
+	if (chunk.size() >= chunkRows * rowSize) {
+		flush();
+	}
+}
+
+/**
+	Writes the rows gathered at the end of the file, then the new row count in its header
+	Throws std::runtime_error if the file can't be written
+*/
+void NpyWriter::flush()
+{
+	if (chunk.empty()) {
+		return;
+	}
+	file.write(reinterpret_cast<const char*>(chunk.data()), std::streamsize(chunk.size()));
+	writtenRows += chunk.size() / rowSize;
+	chunk.clear();
+	const std::string header = makeHeader(writtenRows);
+	file.seekp(0);
+	file.write(header.data(), std::streamsize(header.size()));
+	file.seekp(std::streamoff(headerSize + writtenRows * rowSize));
+	file.flush();
+	if (!file) {
+		throw std::runtime_error("Can't write " + path);
+	}
+}
+
+/**
+	Drops the rows past a count, e.g. to line up the columns of a dataset whose writing was cut short
+	The next rows are written over them
+
+	@param rows Rows kept, no more than getRowCount()
+*/
+void NpyWriter::truncate(std::uint64_t rows)
+{
+	assert(rows <= getRowCount());
+	if (rows >= writtenRows) {
+		chunk.resize(std::size_t(rows - writtenRows) * rowSize);
+		return;
+	}
+	chunk.clear();
+	writtenRows = rows;
+	const std::string header = makeHeader(writtenRows);
+	file.seekp(0);
+	file.write(header.data(), std::streamsize(header.size()));
+	file.seekp(std::streamoff(headerSize + writtenRows * rowSize));
+}
+
+/**
+	Returns the number of rows, written or gathered
+
+	@return count
+*/
+std::uint64_t NpyWriter::getRowCount() const
+{
+	return writtenRows + chunk.size() / rowSize;
+}
+
+/**
+	Returns the number of bytes in a row
+
+	@return size
+*/
+std::size_t NpyWriter::getRowSize() const
+{
+	return rowSize;
+}
+
+/**
+	Returns the most memory the gathered rows take
+
+	@return bytes
+*/
+std::size_t NpyWriter::getChunkSize() const
+{
+	return chunkRows * rowSize;
+}
+
+/**
+	Returns the file's header for a number of rows: preamble, then the array's description padded with spaces
+	to headerSize bytes (once known) and ended by a newline
+
+	@param rows Number of rows
+	@return header
+*/
+std::string NpyWriter::makeHeader(std::uint64_t rows) const
+{
+	std::string shape = "(" + std::to_string(rows) + ",";
+	for (std::size_t d = 0; d < rowShape.size(); ++d) {
+		shape += (d == 0 ? " " : ", ") + std::to_string(rowShape[d]);
+	}
+	shape += ")";
+	std::string header = std::string(MAGIC, 6) + '\x01' + '\x00' + "  "
+		+ "{'descr': '" + type + "', 'fortran_order': False, 'shape': " + shape + ", }";
+	const std::size_t size = headerSize > 0 ? headerSize : (header.size() + 1 + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+	header.resize(size - 1, ' ');
+	header += '\n';
+	const std::size_t length = size - PREAMBLE_SIZE;
+	header[8] = char(length & 0xFF);
+	header[9] = char(length >> 8);
+	return header;
+}
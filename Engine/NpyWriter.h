@@ -0,0 +1,53 @@
+/**
+	Writes one column of a dataset as a NumPy .npy file (format version 1.0), a row at a time: rows are gathered
+	into a chunk of chunkRows rows, which is appended to the file once full. After every chunk the header is
+	rewritten in place with the new number of rows, so the file can be loaded at any time (np.load, or np.memmap for
+	files bigger than memory) and memory never holds more than one chunk
+	The header is padded to a fixed size that fits any row count, so rewriting it never moves the data.
+	An existing file can be appended to: only its header is read, checked against the column's type and shape,
+	and rows past its row count (left by a chunk cut short) are written over
+
+	Types are NumPy type strings, little endian like the machines the game runs on (e.g. "<u8", "<i4", "<f4", "|u1")
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class NpyWriter {
+public:
+	NpyWriter(const std::string& path, const std::string& type, const std::vector<std::uint64_t>& rowShape,
+		std::size_t chunkRows = 1 << 16, bool appends = false);
+	NpyWriter(const NpyWriter&) = delete;
+	NpyWriter& operator=(const NpyWriter&) = delete;
+	~NpyWriter();
+
+	void append(const void* row);
+	void flush();
+	void truncate(std::uint64_t rows);
+	std::uint64_t getRowCount() const;
+	std::size_t getRowSize() const;
+	std::size_t getChunkSize() const;
+
+private:
+	std::string makeHeader(std::uint64_t rows) const;
+
+private:
+	static constexpr std::size_t ALIGNMENT = 64;	// Header size is a multiple of it, as the format asks
+	std::string path;
+	std::string type;
+	std::vector<std::uint64_t> rowShape;		// Shape of a row, empty for scalars
+	std::size_t rowSize;						// Bytes per row
+	std::size_t headerSize = 0;				// Fixed once the longest header is known
+	std::size_t chunkRows;
+	std::vector<std::uint8_t> chunk;			// Rows not written yet
+	std::uint64_t writtenRows = 0;
+	std::fstream file;
+};
@@ -0,0 +1,178 @@
+/**
+	Body of the snake stored as the head and tail locations plus the direction of every link between
+	two neighbouring segments, packed 2 bits per link into 64-bit words (32 links per word)
+	That is 32x less memory than a Vec2_<int> per segment, so huge snakes and snapshots of them are cheap to copy
+	The links form a circular buffer: moving pushes a link at the head and drops one at the tail in constant time
+	Segment locations are decoded on the fly, walking from the head (see Iterator), so random access is O(index)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Storage.h"
+#include "Vec2.h"
+#include <cstdint>
+#include <iterator>
+#include <stdlib.h>
+#include <assert.h>
+
+template<int CAPACITY>
+class PackedBody {
+public:
+	/**
+		Walks the segments from the head to the tail, decoding one link per step
+	*/
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Vec2_<int>;
+		using difference_type = int;
+		using pointer = const Vec2_<int>*;
+		using reference = const Vec2_<int>&;
+
+		Iterator(const PackedBody* body, int index, Vec2_<int> location)
+			:
+			body(body),
+			index(index),
+			location(location)
+		{}
+		const Vec2_<int>& operator*() const
+		{
+			return location;
+		}
+		const Vec2_<int>* operator->() const
+		{
+			return &location;
+		}
+		Iterator& operator++()
+		{
+			location -= decode(body->getLink(index));	// The link points from this segment's follower towards it
+			++index;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+		bool operator==(const Iterator& rhs) const
+		{
+			return index == rhs.index;
+		}
+		bool operator!=(const Iterator& rhs) const
+		{
+			return index != rhs.index;
+		}
+
+	private:
+		const PackedBody* body;
+		int index;				// Index of the segment, 0 being the head
+		Vec2_<int> location;	// Location of that segment
+	};
+
+public:
+	PackedBody(int cellCount)
+		:
+		words(Storage<std::uint64_t, WORD_CAPACITY>::make((cellCount * 2 + 63) / 64)),
+		capacity(cellCount)
+	{}
+	void reset(Vec2_<int> location)	// One segment
+	{
+		head = location;
+		tail = location;
+		first = 0;
+		links = 0;
+	}
+	void pushFront(Vec2_<int> dir)	// New head next to the current one, in direction dir
+	{
+		assert(links < capacity);
+		first = first == 0 ? capacity - 1 : first - 1;
+		setSlot(first, encode(dir));
+		++links;
+		head += dir;
+	}
+	void pushBack(Vec2_<int> location)	// New tail next to the current one
+	{
+		assert(links < capacity);
+		assert(abs(tail.x - location.x) + abs(tail.y - location.y) == 1);
+		setSlot(wrap(first + links), encode(tail - location));
+		++links;
+		tail = location;
+	}
+	void popBack()
+	{
+		assert(links > 0);
+		--links;
+		tail += decode(getLink(links));
+	}
+	Vec2_<int> front() const
+	{
+		return head;
+	}
+	Vec2_<int> back() const
+	{
+		return tail;
+	}
+	Vec2_<int> operator[](int index) const	// 0 is the head, O(index)
+	{
+		assert(index >= 0 && index < size());
+		Iterator it = begin();
+		for (int i = 0; i < index; ++i) {
+			++it;
+		}
+		return *it;
+	}
+	Iterator begin() const
+	{
+		return Iterator(this, 0, head);
+	}
+	Iterator end() const
+	{
+		return Iterator(this, size(), tail);
+	}
+	int size() const
+	{
+		return links + 1;
+	}
+	int getWordCount() const
+	{
+		return (int)words.size();
+	}
+	static int encode(Vec2_<int> dir)	// 0 right, 1 down, 2 left, 3 up (BatchSimulation stores links in the same format)
+	{
+		assert(abs(dir.x) + abs(dir.y) == 1);
+		return dir.x != 0 ? 1 - dir.x : 2 - dir.y;
+	}
+	static Vec2_<int> decode(int code)
+	{
+		return (code & 1) ? Vec2_<int>(0, 2 - code) : Vec2_<int>(1 - code, 0);
+	}
+
+private:
+	int getLink(int index) const	// Direction from segment index + 1 to segment index
+	{
+		const int slot = wrap(first + index);
+		return int(words[slot >> 5] >> ((slot & 31) * 2)) & 3;
+	}
+	void setSlot(int slot, int code)
+	{
+		const int shift = (slot & 31) * 2;
+		words[slot >> 5] = (words[slot >> 5] & ~(std::uint64_t(3) << shift)) | (std::uint64_t(code) << shift);
+	}
+	int wrap(int slot) const
+	{
+		return slot >= capacity ? slot - capacity : slot;
+	}
+
+private:
+	static constexpr int WORD_CAPACITY = CAPACITY == DYNAMIC_CAPACITY ? DYNAMIC_CAPACITY : (CAPACITY * 2 + 63) / 64;
+	typename Storage<std::uint64_t, WORD_CAPACITY>::Type words;
+	int capacity;				// Number of link slots, one per tile of the grid
+	int first = 0;				// Slot of the link behind the head
+	int links = 0;				// Number of links, one less than the number of segments
+	Vec2_<int> head = { DIR_ZERO };
+	Vec2_<int> tail = { DIR_ZERO };
+};
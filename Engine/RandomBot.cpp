@@ -0,0 +1,81 @@
+#include "RandomBot.h"
+
+/**
+	Constructs the bot
+
+	@param seed Seed of the bot's choices
+	@param avoidsCollisions Whether the bot avoids moves into a wall / the body when it can
+*/
+template<typename GridType>
+BasicRandomBot<GridType>::BasicRandomBot(std::uint64_t seed, bool avoidsCollisions)
+	:
+	seed(seed),
+	rng(seed),
+	avoidsCollisions(avoidsCollisions)
+{
+}
+
+/**
+	Starts the stream of choices for a new game
+
+	@param sim Game which has just been reset
+*/
+template<typename GridType>
+void BasicRandomBot<GridType>::reset(const BasicSimulation<GridType>& sim)
+{
+	rng = CounterRng(CounterRng::mix(seed ^ sim.getSeed()));
+}
+
+/**
+	Picks the action for the next step. The first move is upwards, as the snake starts in the bottom row
+
+	@param sim Game to play
+	@return action
+*/
+template<typename GridType>
+SimulationBase::Action BasicRandomBot<GridType>::act(const BasicSimulation<GridType>& sim)
+{
+	using Action = SimulationBase::Action;
+	if (sim.getSnake().getDirection() == Vec2_<int>(DIR_ZERO)) {
+		return Action::Up;
+	}
+
+	const std::uint64_t bits = rng(sim.getTick());
+	Action action = (bits & 7) == 0 ? Action(1 + ((bits >> 3) & 3)) : Action::None;
+	if (!avoidsCollisions || isSafe(sim, action)) {
+		return action;
+	}
+	const int first = int((bits >> 5) & 3);		// Try the directions starting from a random one
+	for (int i = 0; i < 4; ++i) {
+		const Action candidate = Action(1 + (first + i) % 4);
+		if (isSafe(sim, candidate)) {
+			return candidate;
+		}
+	}
+	return action;		// Every move is deadly
+}
+
+/**
+	States whether or not an action keeps the snake alive for the next step
+
+	@param sim Game to play
+	@param action Action to check, Action::None keeps the current direction
+	@return bool
+*/
+template<typename GridType>
+bool BasicRandomBot<GridType>::isSafe(const BasicSimulation<GridType>& sim, SimulationBase::Action action) const
+{
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	Vec2_<int> dir = SimulationBase::toDirection(action);
+	if (action == SimulationBase::Action::None || dir == -snek.getDirection()) {
+		dir = snek.getDirection();		// The snake keeps going
+	}
+	const Vec2_<int> next = snek.getHeadLocation() + dir;
+	return sim.getGrid().isInside(next) && !snek.isInTile(next);
+}
+
+template class BasicRandomBot<Grid>;
+template class BasicRandomBot<ClassicGrid>;
+template class BasicRandomBot<MediumGrid>;
+template class BasicRandomBot<LargeGrid>;
+template class BasicRandomBot<HugeGrid>;
@@ -0,0 +1,32 @@
+/**
+	Autopilot which turns to a random direction on 1 in 8 ticks
+	With collision avoidance it also refuses moves into a wall / the body whenever another move is safe,
+	so its games last from a few to thousands of ticks. Used as a baseline for the other bots
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include "CounterRng.h"
+#include <cstdint>
+
+template<typename GridType>
+class BasicRandomBot : public BasicBot<GridType> {
+public:
+	BasicRandomBot(std::uint64_t seed, bool avoidsCollisions);
+	void reset(const BasicSimulation<GridType>& sim) override;
+	SimulationBase::Action act(const BasicSimulation<GridType>& sim) override;
+
+private:
+	bool isSafe(const BasicSimulation<GridType>& sim, SimulationBase::Action action) const;
+
+private:
+	std::uint64_t seed;
+	CounterRng rng;				// Keyed by the bot's seed and the game's seed, so a game is played the same way every time
+	bool avoidsCollisions;
+};
+
+using RandomBot = BasicRandomBot<ClassicGrid>;
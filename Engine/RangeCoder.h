@@ -0,0 +1,167 @@
+/**
+	Binary adaptive range coder (the one LZMA uses): each bit is coded with a probability that adapts to the bits
+	seen in its context, so a bit that is nearly always the same costs a small fraction of a bit.
+	Bits can also be coded directly, at one bit each, for values with no pattern (e.g. seeds)
+
+	Probabilities are 11-bit estimates of the bit being 0, start at one half and move 1/32 of the way towards
+	each coded bit. The encoder appends bytes as soon as they are known, so its output can be written out (and cleared)
+	between bits; flush writes the last bytes once everything is coded
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace RangeCoder {
+	constexpr int PROBABILITY_BITS = 11;
+	constexpr std::uint16_t HALF = 1 << (PROBABILITY_BITS - 1);
+	constexpr int ADAPT_SHIFT = 5;
+	constexpr std::uint32_t TOP = 1u << 24;
+
+	class Encoder {
+	public:
+		Encoder(std::vector<std::uint8_t>& out)
+			:
+			out(out)
+		{}
+		void encodeBit(std::uint16_t& probability, int bit)
+		{
+			const std::uint32_t bound = (range >> PROBABILITY_BITS) * probability;
+			if (bit == 0) {
+				range = bound;
+				probability += ((1 << PROBABILITY_BITS) - probability) >> ADAPT_SHIFT;
+			}
+			else {
+				low += bound;
+				range -= bound;
+				probability -= probability >> ADAPT_SHIFT;
+			}
+			normalize();
+		}
+		void encodeDirect(std::uint32_t value, int nBits)	// Highest bit first
+		{
+			for (int i = nBits - 1; i >= 0; --i) {
+				range >>= 1;
+				if ((value >> i) & 1) {
+					low += range;
+				}
+				normalize();
+			}
+		}
+		void flush()
+		{
+			for (int i = 0; i < 5; ++i) {
+				shiftLow();
+			}
+		}
+
+	private:
+		void normalize()
+		{
+			while (range < TOP) {
+				range <<= 8;
+				shiftLow();
+			}
+		}
+		void shiftLow()		// Bytes equal to 0xFF wait in cacheSize until a carry can no longer change them
+		{
+			if (std::uint32_t(low) < 0xFF000000u || (low >> 32) != 0) {
+				const std::uint8_t carry = std::uint8_t(low >> 32);
+				std::uint8_t byte = cache;
+				do {
+					out.push_back(std::uint8_t(byte + carry));
+					byte = 0xFF;
+				} while (--cacheSize != 0);
+				cache = std::uint8_t(low >> 24);
+			}
+			++cacheSize;
+			low = (low & 0x00FFFFFFu) << 8;
+		}
+
+	private:
+		std::vector<std::uint8_t>& out;
+		std::uint64_t low = 0;
+		std::uint32_t range = 0xFFFFFFFFu;
+		std::uint8_t cache = 0;
+		std::uint64_t cacheSize = 1;
+	};
+
+	class Decoder {
+	public:
+		Decoder(const std::uint8_t* data, std::size_t size)
+			:
+			data(data),
+			size(size)
+		{
+			for (int i = 0; i < 5; ++i) {
+				code = (code << 8) | nextByte();
+			}
+		}
+		int decodeBit(std::uint16_t& probability)
+		{
+			const std::uint32_t bound = (range >> PROBABILITY_BITS) * probability;
+			int bit;
+			if (code < bound) {
+				range = bound;
+				probability += ((1 << PROBABILITY_BITS) - probability) >> ADAPT_SHIFT;
+				bit = 0;
+			}
+			else {
+				code -= bound;
+				range -= bound;
+				probability -= probability >> ADAPT_SHIFT;
+				bit = 1;
+			}
+			normalize();
+			return bit;
+		}
+		std::uint32_t decodeDirect(int nBits)
+		{
+			std::uint32_t value = 0;
+			for (int i = 0; i < nBits; ++i) {
+				range >>= 1;
+				const std::uint32_t bit = code >= range;
+				code -= range & (0u - bit);
+				value = (value << 1) | bit;
+				normalize();
+			}
+			return value;
+		}
+		std::size_t getOffset() const	// Bytes read so far
+		{
+			return offset;
+		}
+
+	private:
+		void normalize()
+		{
+			while (range < TOP) {
+				range <<= 8;
+				code = (code << 8) | nextByte();
+			}
+		}
+		std::uint8_t nextByte()		// Reads as zeros for a few bytes past the end, then data cut short is an error
+		{
+			if (offset < size) {
+				return data[offset++];
+			}
+			if (++offset > size + 8) {
+				throw std::runtime_error("Range coded data ends too early");
+			}
+			return 0;
+		}
+
+	private:
+		const std::uint8_t* data;
+		std::size_t size;
+		std::size_t offset = 0;
+		std::uint32_t range = 0xFFFFFFFFu;
+		std::uint32_t code = 0;
+	};
+}
@@ -0,0 +1,351 @@
+#include "Replay.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <assert.h>
+
+constexpr std::uint8_t Replay::VERSION;
+constexpr std::size_t Replay::HEADER_SIZE;
+constexpr int Replay::SPEED;
+constexpr int Replay::KEYFRAME;
+constexpr int Replay::BEGIN;
+constexpr int Replay::END;
+
+namespace {
+	const std::uint8_t MAGIC[4] = { 'S', 'N', 'K', 'R' };
+	const std::uint8_t SIGNATURE[5] = { Replay::BEGIN, 'S', 'N', 'K', 'R' };	// Start of a header
+
+	template<typename T>
+	T readLittleEndian(const std::uint8_t* data)
+	{
+		T value = 0;
+		for (int i = int(sizeof(T)) - 1; i >= 0; --i) {
+			value = T(value << 8) | data[i];
+		}
+		return value;
+	}
+
+	template<typename T>
+	void writeLittleEndian(std::vector<std::uint8_t>& out, T value)
+	{
+		for (std::size_t i = 0; i < sizeof(T); ++i) {
+			out.push_back(std::uint8_t(value >> (8 * i)));
+		}
+	}
+}
+
+/**
+	Returns the header of a recording starting from a game's current state: grid, speed level and seed
+
+	@param sim Game about to be recorded, before its first step
+	@return header
+*/
+template<typename GridType>
+Replay::Header Replay::makeHeader(const BasicSimulation<GridType>& sim)
+{
+	Header header;
+	header.width = std::uint16_t(sim.getGrid().getWidth());
+	header.height = std::uint16_t(sim.getGrid().getHeight());
+	header.speedLevel = std::uint8_t(sim.getSnake().getSpeed());
+	header.seed = sim.getSeed();
+	return header;
+}
+
+/**
+	Reads the games of a recording
+	Throws std::runtime_error if the data isn't a recording
+
+	@param data Bytes of the recording
+	@param size Number of bytes
+	@return games in the order they were played
+*/
+std::vector<Replay> Replay::decode(const std::uint8_t* data, std::size_t size)
+{
+	std::vector<Replay> replays;
+	std::size_t offset = 0;
+	while (offset < size) {
+		replays.emplace_back();
+		decodeGame(data, size, offset, replays.back());
+	}
+	return replays;
+}
+
+/**
+	Reads the game starting at a byte of a recording
+	Throws std::runtime_error if the data there isn't a game
+
+	@param data Bytes of the recording
+	@param size Number of bytes
+	@param offset Byte the game's header starts at, moved past the game's last record
+	@param replay Receives the game, the memory of its events is reused
+*/
+void Replay::decodeGame(const std::uint8_t* data, std::size_t size, std::size_t& offset, Replay& replay)
+{
+	if (size - offset < HEADER_SIZE || data[offset] != BEGIN || !std::equal(MAGIC, MAGIC + 4, data + offset + 1)) {
+		throw std::runtime_error("Replay header expected at byte " + std::to_string(offset));
+	}
+	if (data[offset + 5] != VERSION) {
+		throw std::runtime_error("Replay version " + std::to_string(data[offset + 5]) + " isn't supported");
+	}
+	replay.header.width = readLittleEndian<std::uint16_t>(data + offset + 6);
+	replay.header.height = readLittleEndian<std::uint16_t>(data + offset + 8);
+	replay.header.speedLevel = data[offset + 10];
+	replay.header.seed = readLittleEndian<std::uint64_t>(data + offset + 11);
+	replay.events.clear();
+	replay.finalScore = 0;
+	replay.isComplete = false;
+	offset += HEADER_SIZE;
+
+	std::uint64_t tick = 0;
+	while (offset < size && !replay.isComplete && (data[offset] & 7) != BEGIN) {
+		const std::uint64_t record = readVarint(data, size, offset);
+		tick += record >> 3;
+		const int kind = int(record & 7);
+		if (kind == END) {
+			replay.finalScore = int(readVarint(data, size, offset));
+			replay.isComplete = true;
+		}
+		else if (kind < 4) {
+			replay.events.push_back({ tick, SimulationBase::Action(kind + 1), 0 });
+		}
+		else if (kind == SPEED && offset < size) {
+			replay.events.push_back({ tick, SimulationBase::Action::None, data[offset++] });
+		}
+		else {
+			throw std::runtime_error("Replay has an unknown record kind at byte " + std::to_string(offset));
+		}
+	}
+	replay.finalTick = tick;
+}
+
+/**
+	Finds where the game starting at a byte of a recording ends, without decoding it: records are stepped over
+	by their kinds and the lengths of their varints alone. Data there which isn't a well-formed game (bad header,
+	unknown record kind, record cut short) is skipped up to the next game header, for decodeGame to refuse
+
+	@param data Bytes of the recording
+	@param size Number of bytes
+	@param offset Byte the game starts at
+	@return byte after the game's last record, or after the data which isn't a game: the next header, or size
+*/
+std::size_t Replay::skipGame(const std::uint8_t* data, std::size_t size, std::size_t offset)
+{
+	const std::size_t start = offset;
+	const auto skipVarint = [&]() {
+		for (int i = 0; i < 10 && offset < size; ++i) {		// As long as readVarint reads
+			if (!(data[offset++] & 0x80)) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	bool isWellFormed = size - offset >= HEADER_SIZE && std::equal(SIGNATURE, SIGNATURE + 5, data + offset);
+	if (isWellFormed) {
+		offset += HEADER_SIZE;
+	}
+	while (isWellFormed && offset < size && (data[offset] & 7) != BEGIN) {
+		const int kind = data[offset] & 7;
+		isWellFormed = skipVarint() && kind != KEYFRAME;
+		if (isWellFormed && kind == END) {
+			if (skipVarint()) {
+				return offset;
+			}
+			isWellFormed = false;
+		}
+		else if (isWellFormed && kind == SPEED) {
+			isWellFormed = offset++ < size;
+		}
+	}
+	if (isWellFormed) {
+		return offset;
+	}
+	return std::size_t(std::search(data + start + 1, data + size, SIGNATURE, SIGNATURE + 5) - data);
+}
+
+/**
+	Reads the games of a recording from a file
+	Throws std::runtime_error if the file can't be read or isn't a recording
+
+	@param path File of the recording
+	@return games in the order they were played
+*/
+std::vector<Replay> Replay::load(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	return decode(bytes.data(), bytes.size());
+}
+
+/**
+	Appends the game's record
+
+	@param out Receives the bytes
+*/
+void Replay::encode(std::vector<std::uint8_t>& out) const
+{
+	writeHeader(out, header);
+	std::uint64_t tick = 0;
+	for (const Event& event : events) {
+		if (event.action == SimulationBase::Action::None) {
+			writeSpeed(out, event.tick - tick, event.speedLevel);
+		}
+		else {
+			writeEvent(out, event.tick - tick, event.action);
+		}
+		tick = event.tick;
+	}
+	if (isComplete) {
+		writeEnd(out, finalTick - tick, finalScore);
+	}
+}
+
+/**
+	Plays the game again: resets the simulation with the recorded speed level and seed, then queues every action
+	(or changes the speed level) after as many steps as when it was recorded, and steps on to the final tick
+	(or until the game is over)
+
+	@param sim Simulation on a grid of the recorded size
+*/
+template<typename GridType>
+void Replay::play(BasicSimulation<GridType>& sim) const
+{
+	if (sim.getGrid().getWidth() != header.width || sim.getGrid().getHeight() != header.height) {
+		throw std::runtime_error("Replay was recorded on another grid size");
+	}
+	sim.getSnake().setSpeed(header.speedLevel);
+	sim.reset(header.seed);
+	for (const Event& event : events) {
+		while (sim.getTick() < event.tick && !sim.isGameOver()) {
+			sim.step();
+		}
+		if (event.action == SimulationBase::Action::None) {
+			sim.getSnake().setSpeed(event.speedLevel);
+		}
+		else {
+			sim.queueAction(event.action);
+		}
+	}
+	while (sim.getTick() < finalTick && !sim.isGameOver()) {
+		sim.step();
+	}
+}
+
+/**
+	States whether or not a replayed game ended the way the recording did: same tick and score
+
+	@param sim Simulation the game was replayed on with play
+	@return bool, false if the recording has no end record
+*/
+template<typename GridType>
+bool Replay::matches(const BasicSimulation<GridType>& sim) const
+{
+	return isComplete && sim.getTick() == finalTick && sim.getScore() == finalScore;
+}
+
+/**
+	Appends a game's header
+
+	@param out Receives the bytes
+	@param header Grid, speed level and seed
+*/
+void Replay::writeHeader(std::vector<std::uint8_t>& out, const Header& header)
+{
+	out.push_back(std::uint8_t(BEGIN));
+	out.insert(out.end(), MAGIC, MAGIC + 4);
+	out.push_back(VERSION);
+	writeLittleEndian(out, header.width);
+	writeLittleEndian(out, header.height);
+	out.push_back(header.speedLevel);
+	writeLittleEndian(out, header.seed);
+}
+
+/**
+	Appends an action
+
+	@param out Receives the bytes
+	@param ticksSinceLast Steps taken since the previous record (or the start)
+	@param action Action::Up to Action::Right
+*/
+void Replay::writeEvent(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, SimulationBase::Action action)
+{
+	assert(action != SimulationBase::Action::None);
+	writeVarint(out, ticksSinceLast << 3 | std::uint64_t(int(action) - 1));
+}
+
+/**
+	Appends a change of the speed level
+
+	@param out Receives the bytes
+	@param ticksSinceLast Steps taken since the previous record
+	@param speedLevel New speed level
+*/
+void Replay::writeSpeed(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, int speedLevel)
+{
+	writeVarint(out, ticksSinceLast << 3 | SPEED);
+	out.push_back(std::uint8_t(speedLevel));
+}
+
+/**
+	Appends the end of a game
+
+	@param out Receives the bytes
+	@param ticksSinceLast Steps taken since the previous record
+	@param score Final score
+*/
+void Replay::writeEnd(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, int score)
+{
+	writeVarint(out, ticksSinceLast << 3 | END);
+	writeVarint(out, std::uint64_t(score));
+}
+
+/**
+	Appends an unsigned number, 7 bits per byte from the lowest ones, the high bit of a byte set when more follow
+
+	@param out Receives the bytes
+	@param value Number
+*/
+void Replay::writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value)
+{
+	while (value >= 0x80) {
+		out.push_back(std::uint8_t(value | 0x80));
+		value >>= 7;
+	}
+	out.push_back(std::uint8_t(value));
+}
+
+/**
+	Reads an unsigned number written by writeVarint
+	Throws std::runtime_error if the data ends before the number does
+
+	@param data Bytes to read from
+	@param size Number of bytes
+	@param offset Byte the number starts at, moved past its end
+	@return number
+*/
+std::uint64_t Replay::readVarint(const std::uint8_t* data, std::size_t size, std::size_t& offset)
+{
+	std::uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 7) {
+		if (offset >= size) {
+			throw std::runtime_error("Replay ends in the middle of a record");
+		}
+		const std::uint8_t byte = data[offset++];
+		value |= std::uint64_t(byte & 0x7F) << shift;
+		if (!(byte & 0x80)) {
+			return value;
+		}
+	}
+	throw std::runtime_error("Replay has a varint longer than 64 bits");
+}
+
+template Replay::Header Replay::makeHeader(const BasicSimulation<Grid>&);
+template Replay::Header Replay::makeHeader(const BasicSimulation<ClassicGrid>&);
+template void Replay::play(BasicSimulation<Grid>&) const;
+template void Replay::play(BasicSimulation<ClassicGrid>&) const;
+template bool Replay::matches(const BasicSimulation<Grid>&) const;
+template bool Replay::matches(const BasicSimulation<ClassicGrid>&) const;
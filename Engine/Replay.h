@@ -0,0 +1,79 @@
+/**
+	Inputs of a recorded game: the grid size, speed level and food seed it started with, and every action queued
+	during it with the tick it was queued at, along with the speed level changes (the menu can change it while
+	the game is paused, and it sets the score of a food). Replaying queues the same actions between the same steps,
+	so the game plays out the same and ends with the recorded score (see play)
+
+	Binary format, little endian, one record per game (games of a session follow each other, files can be concatenated):
+		header		BEGIN (1 byte), "SNKR", version (1 byte), width and height (2 bytes each), speed level (1 byte), seed (8 bytes)
+		actions		varint (ticks since the previous record << 3 | action - 1), Action::Up to Action::Right
+		speed		varint (ticks since the previous record << 3 | SPEED), then the new speed level (1 byte)
+		end			varint (ticks since the previous record << 3 | END), then varint score
+	Varints hold 7 bits per byte, low bits first, so an action a few ticks after the last one takes a single byte.
+	The low 3 bits of a record's first byte are its kind, so the BEGIN byte of the next game can't be mistaken for
+	a record: a game cut short (e.g. the program crashed) has no end record and is read as ending with its last action
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Replay {
+public:
+	struct Header {
+		std::uint16_t width = Grid::CLASSIC_WIDTH;
+		std::uint16_t height = Grid::CLASSIC_HEIGHT;
+		std::uint8_t speedLevel = 3;
+		std::uint64_t seed = 0;
+	};
+
+	struct Event {
+		std::uint64_t tick;				// Steps taken before the action was queued
+		SimulationBase::Action action;	// Action::None for a speed level change
+		std::uint8_t speedLevel;		// New speed level of a change
+	};
+
+public:
+	template<typename GridType>
+	static Header makeHeader(const BasicSimulation<GridType>& sim);
+
+	static std::vector<Replay> decode(const std::uint8_t* data, std::size_t size);
+	static void decodeGame(const std::uint8_t* data, std::size_t size, std::size_t& offset, Replay& replay);
+	static std::size_t skipGame(const std::uint8_t* data, std::size_t size, std::size_t offset);
+	static std::vector<Replay> load(const std::string& path);
+	void encode(std::vector<std::uint8_t>& out) const;
+
+	template<typename GridType>
+	void play(BasicSimulation<GridType>& sim) const;
+	template<typename GridType>
+	bool matches(const BasicSimulation<GridType>& sim) const;
+
+	static void writeHeader(std::vector<std::uint8_t>& out, const Header& header);
+	static void writeEvent(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, SimulationBase::Action action);
+	static void writeSpeed(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, int speedLevel);
+	static void writeEnd(std::vector<std::uint8_t>& out, std::uint64_t ticksSinceLast, int score);
+	static void writeVarint(std::vector<std::uint8_t>& out, std::uint64_t value);
+	static std::uint64_t readVarint(const std::uint8_t* data, std::size_t size, std::size_t& offset);
+
+public:
+	static constexpr std::uint8_t VERSION = 1;
+	static constexpr std::size_t HEADER_SIZE = 19;
+
+	Header header;
+	std::vector<Event> events;
+	std::uint64_t finalTick = 0;	// Steps taken when the recording ended
+	int finalScore = 0;
+	bool isComplete = false;		// Has an end record, finalTick and finalScore are known
+
+	static constexpr int SPEED = 4;		// Record kinds after the 4 actions
+	static constexpr int KEYFRAME = 5;	// Only in SeekableReplay files
+	static constexpr int BEGIN = 6;
+	static constexpr int END = 7;
+};
@@ -0,0 +1,533 @@
+#include "ReplayCodec.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <assert.h>
+
+constexpr int ReplayCodec::Model::LENGTHS;
+constexpr int ReplayCodec::Model::GAP_CONTEXTS;
+constexpr int ReplayCodec::Model::HIGH_BITS;
+constexpr std::uint8_t ReplayCodec::VERSION;
+constexpr std::size_t ReplayCodec::MAGIC_SIZE;
+
+namespace {
+	const std::uint8_t MAGIC[4] = { 'S', 'N', 'K', 'Z' };
+
+	int getBitLength(std::uint64_t value)
+	{
+		int length = 0;
+		while (value != 0) {
+			value >>= 1;
+			++length;
+		}
+		return length;
+	}
+
+	/**
+		Returns the side a snake turns to when its direction goes from one action's to the other's
+
+		@return 1 or -1 for a turn, 0 for the same or the opposite direction
+	*/
+	int getTurnSide(SimulationBase::Action from, SimulationBase::Action to)
+	{
+		const Vec2_<int> a = SimulationBase::toDirection(from);
+		const Vec2_<int> b = SimulationBase::toDirection(to);
+		return a.x * b.y - a.y * b.x;
+	}
+
+	SimulationBase::Action turn(SimulationBase::Action from, int side)
+	{
+		const Vec2_<int> dir = SimulationBase::toDirection(from);
+		return SimulationBase::toAction(side > 0 ? Vec2_<int>(-dir.y, dir.x) : Vec2_<int>(dir.y, -dir.x));
+	}
+
+	std::size_t checkMagic(const std::uint8_t* data, std::size_t size)
+	{
+		if (!ReplayDecoder::isEncoded(data, size)) {
+			throw std::runtime_error("Data isn't an encoded replay stream");
+		}
+		if (data[4] != ReplayCodec::VERSION) {
+			throw std::runtime_error("Encoded replay version " + std::to_string(data[4]) + " isn't supported");
+		}
+		return ReplayCodec::MAGIC_SIZE;
+	}
+}
+
+ReplayCodec::Model::Model()
+{
+	static_assert(sizeof(Model) % sizeof(std::uint16_t) == 0, "Model only holds probabilities");
+	std::fill_n(reinterpret_cast<std::uint16_t*>(this), sizeof(Model) / sizeof(std::uint16_t), RangeCoder::HALF);
+}
+
+/**
+	Starts a stream
+
+	@param out Receives the bytes as they are coded, can be written out and cleared between calls
+*/
+ReplayEncoder::ReplayEncoder(std::vector<std::uint8_t>& out)
+	:
+	coder(out)
+{
+	out.insert(out.end(), MAGIC, MAGIC + 4);
+	out.push_back(ReplayCodec::VERSION);
+}
+
+/**
+	Starts a game, ending the previous one as cut short if it wasn't ended
+
+	@param header Grid, speed level and seed of the game
+*/
+void ReplayEncoder::beginGame(const Replay::Header& header)
+{
+	assert(!isFinished);
+	if (isInGame) {
+		cutGame();
+	}
+	coder.encodeBit(model.hasGame, 1);
+	const bool isSameSize = header.width == lastHeader.width && header.height == lastHeader.height;
+	coder.encodeBit(model.sameSize, isSameSize);
+	if (!isSameSize) {
+		coder.encodeDirect(header.width, 16);
+		coder.encodeDirect(header.height, 16);
+	}
+	coder.encodeDirect(header.speedLevel, 8);
+	coder.encodeDirect(std::uint32_t(header.seed >> 32), 32);
+	coder.encodeDirect(std::uint32_t(header.seed), 32);
+	lastHeader = header;
+	lastTick = 0;
+	lastAction = SimulationBase::Action::None;
+	isInGame = true;
+}
+
+/**
+	Codes an action queued on the game
+
+	@param tick Steps the game had taken, no less than the last record's
+	@param action Action::Up to Action::Right
+*/
+void ReplayEncoder::writeAction(std::uint64_t tick, SimulationBase::Action action)
+{
+	assert(isInGame && action != SimulationBase::Action::None);
+	coder.encodeBit(model.isAction, 1);
+	writeGap(tick);
+	if (lastAction == SimulationBase::Action::None) {
+		const int code = int(action) - 1;
+		coder.encodeBit(model.firstAction[1], code >> 1);
+		coder.encodeBit(model.firstAction[2 + (code >> 1)], code & 1);
+	}
+	else {
+		const int side = getTurnSide(lastAction, action);
+		coder.encodeBit(model.isTurn[lastTurns], side != 0);
+		if (side != 0) {
+			coder.encodeBit(model.turnSide[lastTurns], side > 0);
+			lastTurns = (lastTurns << 1 | (side > 0)) & 3;
+		}
+		else {
+			coder.encodeBit(model.isReverse, action != lastAction);
+		}
+	}
+	lastAction = action;
+}
+
+/**
+	Codes a change of the speed level
+
+	@param tick Steps the game had taken, no less than the last record's
+	@param speedLevel New speed level
+*/
+void ReplayEncoder::writeSpeed(std::uint64_t tick, int speedLevel)
+{
+	assert(isInGame);
+	coder.encodeBit(model.isAction, 0);
+	coder.encodeBit(model.isEnd, 0);
+	coder.encodeBit(model.isCut, 0);
+	writeGap(tick);
+	coder.encodeDirect(std::uint32_t(speedLevel), 8);
+}
+
+/**
+	Ends the game
+
+	@param tick Steps the game took
+	@param score Final score
+*/
+void ReplayEncoder::endGame(std::uint64_t tick, int score)
+{
+	assert(isInGame && score >= 0);
+	coder.encodeBit(model.isAction, 0);
+	coder.encodeBit(model.isEnd, 1);
+	writeGap(tick);
+	writeNumber(model.scoreLength, model.scoreHighBits, std::uint64_t(score));
+	isInGame = false;
+}
+
+/**
+	Ends the game without a final tick and score, like a Replay without an end record
+*/
+void ReplayEncoder::cutGame()
+{
+	assert(isInGame);
+	coder.encodeBit(model.isAction, 0);
+	coder.encodeBit(model.isEnd, 0);
+	coder.encodeBit(model.isCut, 1);
+	isInGame = false;
+}
+
+/**
+	Codes a whole game
+
+	@param replay Game
+*/
+void ReplayEncoder::writeGame(const Replay& replay)
+{
+	beginGame(replay.header);
+	for (const Replay::Event& event : replay.events) {
+		if (event.action == SimulationBase::Action::None) {
+			writeSpeed(event.tick, event.speedLevel);
+		}
+		else {
+			writeAction(event.tick, event.action);
+		}
+	}
+	if (replay.isComplete) {
+		endGame(replay.finalTick, replay.finalScore);
+	}
+	else {
+		cutGame();
+	}
+}
+
+/**
+	Ends the stream and writes its last bytes, nothing can be coded after
+*/
+void ReplayEncoder::finish()
+{
+	assert(!isFinished);
+	if (isInGame) {
+		cutGame();
+	}
+	coder.encodeBit(model.hasGame, 0);
+	coder.flush();
+	isFinished = true;
+}
+
+void ReplayEncoder::writeGap(std::uint64_t tick)
+{
+	assert(tick >= lastTick);
+	const std::uint64_t gap = tick - lastTick;
+	writeNumber(model.gapLength[std::min(lastGapLength, ReplayCodec::Model::GAP_CONTEXTS - 1)], model.gapHighBits, gap);
+	lastGapLength = getBitLength(gap + 1);
+	lastTick = tick;
+}
+
+/**
+	Codes a number as value + 1: its bit length in unary, the bits below the top one, the highest ones with contexts
+
+	@param lengthContexts LENGTHS probabilities of "longer" for each length
+	@param highBitContexts Probabilities of the high bits for each length, as a binary tree
+	@param value Number, less than 2^62
+*/
+void ReplayEncoder::writeNumber(std::uint16_t* lengthContexts, std::uint16_t (*highBitContexts)[1 << ReplayCodec::Model::HIGH_BITS], std::uint64_t value)
+{
+	assert(value < std::uint64_t(1) << 62);
+	const std::uint64_t number = value + 1;
+	const int length = getBitLength(number);
+	for (int i = 1; i < length; ++i) {
+		coder.encodeBit(lengthContexts[i], 1);
+	}
+	coder.encodeBit(lengthContexts[length], 0);
+
+	int bit = length - 2;	// Below the top bit, which is always 1
+	for (int node = 1; bit >= 0 && node < (1 << ReplayCodec::Model::HIGH_BITS); --bit) {
+		const int b = int(number >> bit) & 1;
+		coder.encodeBit(highBitContexts[length][node], b);
+		node = node << 1 | b;
+	}
+	for (; bit >= 0; bit -= 32) {
+		const int nBits = std::min(bit + 1, 32);
+		coder.encodeDirect(std::uint32_t(number >> (bit + 1 - nBits)) & std::uint32_t((std::uint64_t(1) << nBits) - 1), nBits);
+	}
+}
+
+/**
+	Starts reading a stream, or streams one after the other
+	Throws std::runtime_error if the data doesn't start with one
+
+	@param data Bytes of the streams, valid while the decoder reads them
+	@param size Number of bytes
+*/
+ReplayDecoder::ReplayDecoder(const std::uint8_t* data, std::size_t size)
+	:
+	data(data),
+	size(size),
+	coder(data + checkMagic(data, size), 0)		// Set up by startStream
+{
+	startStream(0);
+}
+
+/**
+	Reads the next record: a game's start, one of its actions or speed changes, or its end
+	A stream that can't be decoded to its end (e.g. the program recording it was killed) is read up to the damage:
+	the game it was in, if any, ends there with a Cut record, and reading goes on with the next stream
+
+	@param record Receives the record
+	@return bool, false once every game has been read
+*/
+bool ReplayDecoder::read(ReplayCodec::Record& record)
+{
+	while (!isFinished) {
+		const bool wasInGame = isInGame;
+		const std::uint64_t tick = lastTick;
+		bool hasRecord = false;
+		bool isDamaged = false;
+		try {
+			hasRecord = readRecord(record);
+			isDamaged = ReplayCodec::MAGIC_SIZE + coder.getOffset() > streamEnd - streamStart;	// Decoded from bytes past the stream's
+		}
+		catch (const std::runtime_error&) {
+			isDamaged = true;
+		}
+		if (hasRecord && !isDamaged) {
+			return true;
+		}
+		if (isDamaged) {
+			++nDamagedStreams;
+		}
+		isInGame = false;
+		if (streamEnd < size) {
+			startStream(streamEnd);
+		}
+		else {
+			isFinished = true;
+		}
+		if (isDamaged && wasInGame) {
+			record.kind = ReplayCodec::Record::Kind::Cut;
+			record.tick = tick;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+	Reads the next record of the stream being read
+	Throws std::runtime_error if the data ends before the stream does
+
+	@param record Receives the record
+	@return bool, false once the stream has no more games
+*/
+bool ReplayDecoder::readRecord(ReplayCodec::Record& record)
+{
+	using Kind = ReplayCodec::Record::Kind;
+	if (!isInGame) {
+		if (!coder.decodeBit(model.hasGame)) {
+			return false;
+		}
+		if (!coder.decodeBit(model.sameSize)) {
+			lastHeader.width = std::uint16_t(coder.decodeDirect(16));
+			lastHeader.height = std::uint16_t(coder.decodeDirect(16));
+		}
+		lastHeader.speedLevel = std::uint8_t(coder.decodeDirect(8));
+		const std::uint64_t seedHigh = coder.decodeDirect(32);
+		lastHeader.seed = seedHigh << 32 | coder.decodeDirect(32);
+		lastTick = 0;
+		lastAction = SimulationBase::Action::None;
+		isInGame = true;
+		record.kind = Kind::Begin;
+		record.tick = 0;
+		record.header = lastHeader;
+		return true;
+	}
+
+	if (coder.decodeBit(model.isAction)) {
+		record.kind = Kind::Action;
+		record.tick = readGap();
+		if (lastAction == SimulationBase::Action::None) {
+			const int high = coder.decodeBit(model.firstAction[1]);
+			const int low = coder.decodeBit(model.firstAction[2 + high]);
+			record.action = SimulationBase::Action((high << 1 | low) + 1);
+		}
+		else if (coder.decodeBit(model.isTurn[lastTurns])) {
+			const int side = coder.decodeBit(model.turnSide[lastTurns]);
+			lastTurns = (lastTurns << 1 | side) & 3;
+			record.action = turn(lastAction, side ? 1 : -1);
+		}
+		else if (coder.decodeBit(model.isReverse)) {
+			record.action = SimulationBase::toAction(-SimulationBase::toDirection(lastAction));
+		}
+		else {
+			record.action = lastAction;
+		}
+		lastAction = record.action;
+	}
+	else if (coder.decodeBit(model.isEnd)) {
+		record.kind = Kind::End;
+		record.tick = readGap();
+		record.score = int(readNumber(model.scoreLength, model.scoreHighBits));
+		isInGame = false;
+	}
+	else if (coder.decodeBit(model.isCut)) {
+		record.kind = Kind::Cut;
+		record.tick = lastTick;
+		isInGame = false;
+	}
+	else {
+		record.kind = Kind::Speed;
+		record.tick = readGap();
+		record.speedLevel = int(coder.decodeDirect(8));
+	}
+	return true;
+}
+
+/**
+	Reads the next game whole
+
+	@param replay Receives the game
+	@return bool, false once every game has been read
+*/
+bool ReplayDecoder::readGame(Replay& replay)
+{
+	using Kind = ReplayCodec::Record::Kind;
+	ReplayCodec::Record record;
+	if (isInGame || !read(record)) {
+		return false;
+	}
+	replay = Replay();
+	replay.header = record.header;
+	while (read(record)) {
+		if (record.kind == Kind::Action) {
+			replay.events.push_back({ record.tick, record.action, 0 });
+		}
+		else if (record.kind == Kind::Speed) {
+			replay.events.push_back({ record.tick, SimulationBase::Action::None, std::uint8_t(record.speedLevel) });
+		}
+		else {
+			replay.finalTick = record.tick;
+			replay.finalScore = record.score;
+			replay.isComplete = record.kind == Kind::End;
+			break;
+		}
+	}
+	return true;
+}
+
+/**
+	Reads every game of the streams, up to the damage in streams that were cut short (see read)
+	Throws std::runtime_error if the data doesn't start with a stream
+
+	@param data Bytes of the streams
+	@param size Number of bytes
+	@param damagedStreams Receives the number of streams that couldn't be decoded to their end, if not null
+	@return games in the order they were coded
+*/
+std::vector<Replay> ReplayDecoder::decode(const std::uint8_t* data, std::size_t size, std::size_t* damagedStreams)
+{
+	ReplayDecoder decoder(data, size);
+	std::vector<Replay> replays;
+	Replay replay;
+	while (decoder.readGame(replay)) {
+		replays.push_back(std::move(replay));
+	}
+	if (damagedStreams) {
+		*damagedStreams = decoder.getDamagedStreamCount();
+	}
+	return replays;
+}
+
+/**
+	Reads the games of a replay file, either an encoded stream or in Replay's format
+	Throws std::runtime_error if the file can't be read or is neither
+
+	@param path File of the games
+	@param damagedStreams Receives the number of encoded streams that couldn't be decoded to their end, if not null
+	@return games in the order they were played
+*/
+std::vector<Replay> ReplayDecoder::load(const std::string& path, std::size_t* damagedStreams)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (isEncoded(bytes.data(), bytes.size())) {
+		return decode(bytes.data(), bytes.size(), damagedStreams);
+	}
+	if (damagedStreams) {
+		*damagedStreams = 0;
+	}
+	return Replay::decode(bytes.data(), bytes.size());
+}
+
+/**
+	States whether or not data starts like an encoded stream rather than Replay's format
+
+	@param data Bytes
+	@param size Number of bytes
+	@return bool
+*/
+bool ReplayDecoder::isEncoded(const std::uint8_t* data, std::size_t size)
+{
+	return size >= ReplayCodec::MAGIC_SIZE && std::equal(MAGIC, MAGIC + 4, data);
+}
+
+/**
+	Starts reading the stream at a byte of the data, with fresh models
+	The stream ends where the next one's "SNKZ" and version start, so a stream cut short can't be decoded from the bytes
+	of the next one. Range coded bytes look random, so they hold those 5 bytes by chance about once in 2^40 positions
+
+	@param start Offset of the stream's magic
+*/
+void ReplayDecoder::startStream(std::size_t start)
+{
+	const std::uint8_t signature[ReplayCodec::MAGIC_SIZE] = { MAGIC[0], MAGIC[1], MAGIC[2], MAGIC[3], ReplayCodec::VERSION };
+	streamStart = start;
+	streamEnd = std::size_t(std::search(data + start + ReplayCodec::MAGIC_SIZE, data + size, signature, signature + ReplayCodec::MAGIC_SIZE) - data);
+	coder = RangeCoder::Decoder(data + start + ReplayCodec::MAGIC_SIZE, streamEnd - start - ReplayCodec::MAGIC_SIZE);
+	model = ReplayCodec::Model();
+	lastHeader = Replay::Header();
+	lastGapLength = 0;
+	lastTurns = 0;
+}
+
+/**
+	Returns the number of streams read so far that couldn't be decoded to their end
+
+	@return damaged streams
+*/
+std::size_t ReplayDecoder::getDamagedStreamCount() const
+{
+	return nDamagedStreams;
+}
+
+std::uint64_t ReplayDecoder::readGap()
+{
+	const std::uint64_t gap = readNumber(model.gapLength[std::min(lastGapLength, ReplayCodec::Model::GAP_CONTEXTS - 1)], model.gapHighBits);
+	lastGapLength = getBitLength(gap + 1);
+	lastTick += gap;
+	return lastTick;
+}
+
+std::uint64_t ReplayDecoder::readNumber(std::uint16_t* lengthContexts, std::uint16_t (*highBitContexts)[1 << ReplayCodec::Model::HIGH_BITS])
+{
+	int length = 1;
+	while (coder.decodeBit(lengthContexts[length])) {
+		if (++length == ReplayCodec::Model::LENGTHS - 1) {
+			throw std::runtime_error("Encoded replay has a number longer than 63 bits");
+		}
+	}
+
+	std::uint64_t number = 1;
+	int bit = length - 2;
+	for (int node = 1; bit >= 0 && node < (1 << ReplayCodec::Model::HIGH_BITS); --bit) {
+		const int b = coder.decodeBit(highBitContexts[length][node]);
+		number = number << 1 | std::uint64_t(b);
+		node = node << 1 | b;
+	}
+	for (; bit >= 0; bit -= 32) {
+		const int nBits = std::min(bit + 1, 32);
+		number = number << nBits | coder.decodeDirect(nBits);
+	}
+	return number - 1;
+}
@@ -0,0 +1,143 @@
+/**
+	Compact coding of replay archives (many finished games, see Replay) with an adaptive range coder (see RangeCoder)
+	Most ticks have no input, so a game is coded as the gaps between its records: the bit length of a gap is coded
+	in unary in the context of the previous gap's length, then its highest bits in the context of that length,
+	then the rest directly. A snake can only turn left or right of the way the last key pointed it, so an action
+	is coded as "turned" and "which side", in the context of the last two turns. Speed changes, ends and seeds are rare
+	or random and coded with few contexts
+	The models adapt over the whole stream, so the more games a stream holds, the better they are predicted
+
+	Stream: "SNKZ", version (1 byte), then range coded games, each one preceded by a "game follows" bit and
+	the last one followed by a "no game follows" bit. Games are written and read one record at a time, so a stream
+	is encoded while the games are played (see ReplayRecorder) and decoded while they are replayed
+	A file can hold several streams one after the other, e.g. one per recording session appended to it: the decoder
+	reads them as one, each stream starting with fresh models. A stream left unfinished (the session was killed) is
+	read up to where it was cut, and the streams after it are read as usual
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Replay.h"
+#include "RangeCoder.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class ReplayCodec {
+public:
+	struct Record {
+		enum class Kind {
+			Begin,		// header is set
+			Action,		// tick and action are set
+			Speed,		// tick and speedLevel are set
+			End,		// tick and score are set
+			Cut			// Game ended without an end record, tick is its last record's
+		};
+
+		Kind kind = Kind::Begin;
+		std::uint64_t tick = 0;
+		SimulationBase::Action action = SimulationBase::Action::None;
+		int speedLevel = 0;
+		int score = 0;
+		Replay::Header header;
+	};
+
+	/**
+		Context probabilities, the encoder and decoder update theirs the same way
+	*/
+	struct Model {
+		static constexpr int LENGTHS = 65;			// Bit lengths of 64-bit numbers plus one
+		static constexpr int GAP_CONTEXTS = 16;		// Previous gap lengths told apart
+		static constexpr int HIGH_BITS = 3;			// Highest bits below the top one coded with contexts
+
+		std::uint16_t hasGame;
+		std::uint16_t sameSize;
+		std::uint16_t isAction;
+		std::uint16_t isEnd;
+		std::uint16_t isCut;
+		std::uint16_t gapLength[GAP_CONTEXTS][LENGTHS];
+		std::uint16_t gapHighBits[LENGTHS][1 << HIGH_BITS];
+		std::uint16_t scoreLength[LENGTHS];
+		std::uint16_t scoreHighBits[LENGTHS][1 << HIGH_BITS];
+		std::uint16_t isTurn[4];
+		std::uint16_t turnSide[4];
+		std::uint16_t isReverse;
+		std::uint16_t firstAction[4];
+
+		Model();	// Every probability at one half, all the members are probabilities
+	};
+
+public:
+	static constexpr std::uint8_t VERSION = 1;
+	static constexpr std::size_t MAGIC_SIZE = 5;	// "SNKZ" and the version
+};
+
+class ReplayEncoder {
+public:
+	ReplayEncoder(std::vector<std::uint8_t>& out);
+	ReplayEncoder(const ReplayEncoder&) = delete;
+	ReplayEncoder& operator=(const ReplayEncoder&) = delete;
+
+	void beginGame(const Replay::Header& header);
+	void writeAction(std::uint64_t tick, SimulationBase::Action action);
+	void writeSpeed(std::uint64_t tick, int speedLevel);
+	void endGame(std::uint64_t tick, int score);
+	void cutGame();
+	void writeGame(const Replay& replay);
+	void finish();
+
+private:
+	void writeGap(std::uint64_t tick);
+	void writeNumber(std::uint16_t* lengthContexts, std::uint16_t (*highBitContexts)[1 << ReplayCodec::Model::HIGH_BITS], std::uint64_t value);
+
+private:
+	RangeCoder::Encoder coder;
+	ReplayCodec::Model model;
+	Replay::Header lastHeader;
+	std::uint64_t lastTick = 0;
+	int lastGapLength = 0;
+	SimulationBase::Action lastAction = SimulationBase::Action::None;
+	int lastTurns = 0;						// Sides of the last two turns, 2 bits
+	bool isInGame = false;
+	bool isFinished = false;
+};
+
+class ReplayDecoder {
+public:
+	ReplayDecoder(const std::uint8_t* data, std::size_t size);
+	ReplayDecoder(const ReplayDecoder&) = delete;
+	ReplayDecoder& operator=(const ReplayDecoder&) = delete;
+
+	bool read(ReplayCodec::Record& record);
+	bool readGame(Replay& replay);
+	std::size_t getDamagedStreamCount() const;
+	static std::vector<Replay> decode(const std::uint8_t* data, std::size_t size, std::size_t* damagedStreams = nullptr);
+	static std::vector<Replay> load(const std::string& path, std::size_t* damagedStreams = nullptr);
+	static bool isEncoded(const std::uint8_t* data, std::size_t size);
+
+private:
+	bool readRecord(ReplayCodec::Record& record);
+	void startStream(std::size_t start);
+	std::uint64_t readGap();
+	std::uint64_t readNumber(std::uint16_t* lengthContexts, std::uint16_t (*highBitContexts)[1 << ReplayCodec::Model::HIGH_BITS]);
+
+private:
+	const std::uint8_t* data;
+	std::size_t size;
+	std::size_t streamStart = 0;			// Offset of the stream being read
+	std::size_t streamEnd = 0;				// Offset of the next stream, or size
+	std::size_t nDamagedStreams = 0;
+	RangeCoder::Decoder coder;
+	ReplayCodec::Model model;
+	Replay::Header lastHeader;
+	std::uint64_t lastTick = 0;
+	int lastGapLength = 0;
+	SimulationBase::Action lastAction = SimulationBase::Action::None;
+	int lastTurns = 0;
+	bool isInGame = false;
+	bool isFinished = false;
+};
@@ -0,0 +1,203 @@
+#include "ReplayRecorder.h"
+
+constexpr std::size_t ReplayRecorder::FLUSH_SIZE;
+
+/**
+	Opens the replay file and starts the writer thread
+	If the file can't be opened (e.g. its folder is missing or read-only) the recorder is disabled instead:
+	it records nothing, and isOpen() tells so
+
+	@param path Replay file
+	@param appends true to add the games after those already in the file, false to replace them
+	@param format Replay's format, or a packed stream
+*/
+ReplayRecorder::ReplayRecorder(const std::string& path, bool appends, Format format)
+	:
+	file(path, std::ios::binary | (appends ? std::ios::app : std::ios::trunc))
+{
+	if (!file.is_open()) {
+		return;
+	}
+	if (format == Format::Packed) {
+		encoder.reset(new ReplayEncoder(record));	// Writes the stream's magic
+		append(record, false);
+		record.clear();
+	}
+	writer = std::thread(&ReplayRecorder::writeLoop, this);
+}
+
+/**
+	Writes what is left and stops the writer thread. A game which wasn't ended stays without its end record
+	(in a packed stream, it is coded as cut short)
+*/
+ReplayRecorder::~ReplayRecorder()
+{
+	if (!isOpen()) {
+		return;
+	}
+	if (encoder) {
+		record.clear();
+		encoder->finish();
+		append(record, true);
+	}
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopping = true;
+	}
+	wake.notify_one();
+	writer.join();
+}
+
+/**
+	Starts recording a game. A game still being recorded is left without its end record
+	Call it before the game's first action, the speed level can still change until then. Does nothing if the
+	recorder is disabled
+
+	@param sim Game, not stepped yet
+*/
+template<typename GridType>
+void ReplayRecorder::beginGame(const BasicSimulation<GridType>& sim)
+{
+	if (!isOpen()) {
+		return;
+	}
+	record.clear();
+	const Replay::Header header = Replay::makeHeader(sim);
+	if (encoder) {
+		encoder->beginGame(header);
+	}
+	else {
+		Replay::writeHeader(record, header);
+	}
+	append(record, false);
+	lastTick = 0;
+	speedLevel = header.speedLevel;
+	isInGame = true;
+}
+
+/**
+	Records an action queued into the game
+
+	@param tick Steps the game has taken so far
+	@param action Action::Up to Action::Right
+*/
+void ReplayRecorder::recordAction(std::uint64_t tick, SimulationBase::Action action)
+{
+	if (!isInGame || action == SimulationBase::Action::None) {
+		return;
+	}
+	record.clear();
+	if (encoder) {
+		encoder->writeAction(tick, action);
+	}
+	else {
+		Replay::writeEvent(record, tick - lastTick, action);
+	}
+	append(record, false);
+	lastTick = tick;
+}
+
+/**
+	Records the game's speed level if it changed since the last record, call it before every step
+
+	@param tick Steps the game has taken so far
+	@param newSpeedLevel Speed level of the game
+*/
+void ReplayRecorder::recordSpeed(std::uint64_t tick, int newSpeedLevel)
+{
+	if (!isInGame || newSpeedLevel == speedLevel) {
+		return;
+	}
+	record.clear();
+	if (encoder) {
+		encoder->writeSpeed(tick, newSpeedLevel);
+	}
+	else {
+		Replay::writeSpeed(record, tick - lastTick, newSpeedLevel);
+	}
+	append(record, false);
+	lastTick = tick;
+	speedLevel = newSpeedLevel;
+}
+
+/**
+	Records the end of the game and has the writer write it out
+
+	@param tick Steps the game has taken
+	@param score Score of the game
+*/
+void ReplayRecorder::endGame(std::uint64_t tick, int score)
+{
+	if (!isInGame) {
+		return;
+	}
+	record.clear();
+	if (encoder) {
+		encoder->endGame(tick, score);
+	}
+	else {
+		Replay::writeEnd(record, tick - lastTick, score);
+	}
+	append(record, true);
+	isInGame = false;
+}
+
+/**
+	States whether or not a game is being recorded (beginGame was called, endGame not yet)
+
+	@return bool
+*/
+bool ReplayRecorder::isRecording() const
+{
+	return isInGame;
+}
+
+/**
+	States whether or not the replay file could be opened. If not, the recorder is disabled and records nothing
+
+	@return bool
+*/
+bool ReplayRecorder::isOpen() const
+{
+	return writer.joinable();
+}
+
+void ReplayRecorder::append(const std::vector<std::uint8_t>& bytes, bool flushes)
+{
+	bool wakes;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		pending.insert(pending.end(), bytes.begin(), bytes.end());
+		hasFlush = hasFlush || flushes;
+		wakes = hasFlush || pending.size() >= FLUSH_SIZE;
+	}
+	if (wakes) {
+		wake.notify_one();
+	}
+}
+
+/**
+	Body of the writer thread: waits for bytes to write, takes them, and writes them with the lock released
+*/
+void ReplayRecorder::writeLoop()
+{
+	std::vector<std::uint8_t> writing;
+	std::unique_lock<std::mutex> lock(mutex);
+	for (;;) {
+		wake.wait(lock, [this]() { return isStopping || hasFlush || pending.size() >= FLUSH_SIZE; });
+		writing.swap(pending);
+		hasFlush = false;
+		const bool stops = isStopping;
+		lock.unlock();
+		file.write(reinterpret_cast<const char*>(writing.data()), std::streamsize(writing.size()));
+		file.flush();
+		writing.clear();
+		if (stops) {
+			return;
+		}
+		lock.lock();
+	}
+}
+
+template void ReplayRecorder::beginGame(const BasicSimulation<Grid>&);
+template void ReplayRecorder::beginGame(const BasicSimulation<ClassicGrid>&);
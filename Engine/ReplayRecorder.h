@@ -0,0 +1,67 @@
+/**
+	Records the games of a session into a replay file without the game loop touching the disk:
+	the game thread encodes each record into a memory buffer, and a writer thread swaps that buffer for an empty one
+	and writes it out. The lock is only held to append a few bytes or to swap the buffers, never while writing
+
+	Records are in Replay's format, or range coded as they are played (Format::Packed, see ReplayCodec): a session
+	is then one stream, which is only whole once the recorder is destroyed. Appending to a packed file adds a stream;
+	if the program is killed, its stream is read up to where it was cut and the streams appended later are unaffected
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Replay.h"
+#include "ReplayCodec.h"
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ReplayRecorder {
+public:
+	enum class Format {
+		Plain,		// Replay's format
+		Packed		// ReplayCodec's stream
+	};
+
+public:
+	ReplayRecorder(const std::string& path, bool appends = true, Format format = Format::Plain);
+	ReplayRecorder(const ReplayRecorder&) = delete;
+	ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+	~ReplayRecorder();
+
+	template<typename GridType>
+	void beginGame(const BasicSimulation<GridType>& sim);
+	void recordAction(std::uint64_t tick, SimulationBase::Action action);
+	void recordSpeed(std::uint64_t tick, int speedLevel);
+	void endGame(std::uint64_t tick, int score);
+	bool isRecording() const;
+	bool isOpen() const;
+
+private:
+	void append(const std::vector<std::uint8_t>& bytes, bool flushes);
+	void writeLoop();
+
+private:
+	static constexpr std::size_t FLUSH_SIZE = 4096;	// Bytes buffered before the writer is woken up, the end of a game wakes it too
+	std::ofstream file;
+	std::vector<std::uint8_t> record;		// Bytes of the record being encoded, only used by the game thread
+	std::unique_ptr<ReplayEncoder> encoder;	// Codes into record, for Format::Packed only
+	std::uint64_t lastTick = 0;				// Tick of the game's last record
+	int speedLevel = 0;						// Speed level of the game as recorded so far
+	bool isInGame = false;
+
+	std::mutex mutex;						// Guards the members below
+	std::condition_variable wake;
+	std::vector<std::uint8_t> pending;		// Encoded, waiting for the writer
+	bool hasFlush = false;					// Pending bytes should be written now rather than once FLUSH_SIZE is reached
+	bool isStopping = false;
+	std::thread writer;						// Started last, once the members it uses are constructed
+};
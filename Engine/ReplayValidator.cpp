@@ -0,0 +1,211 @@
+#include "ReplayValidator.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+constexpr int ReplayValidator::VERDICTS;
+
+namespace {
+	constexpr std::size_t CHUNK_SIZE = 64;	// Replays taken from the shared counter at once
+
+	bool isSpeedLevel(int level)			// Offered by the menu
+	{
+		return level >= BasicSnake<ClassicGrid>::MinSpeed && level <= BasicSnake<ClassicGrid>::MaxSpeed;
+	}
+}
+
+ReplayValidator::ReplayValidator(const Settings& settings)
+	:
+	settings(settings)
+{}
+
+/**
+	Checks a batch of replays on every core
+
+	@param replays Submitted games
+	@return verdict of every replay, with the number accepted and the work done
+*/
+ReplayValidator::Report ReplayValidator::validate(const std::vector<Replay>& replays) const
+{
+	return run(replays.size(), [&](std::size_t i, Games& games, std::uint64_t& ticks) {
+		return validate(replays[i], games, ticks);
+	});
+}
+
+/**
+	Checks every game of a recording in Replay's format on every core
+	Data which can't be decoded is refused as Verdict::Malformed, game by game: a damaged game takes the bytes up to
+	the next game header, and data before the first header (or with none) counts as one game
+
+	@param data Bytes of the recording
+	@param size Number of bytes
+	@return verdict of every game, in order, with the number accepted and the work done (finding the games included)
+*/
+ReplayValidator::Report ReplayValidator::validate(const std::uint8_t* data, std::size_t size) const
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::size_t> offsets;		// Where each game starts, followed by the end of the data
+	for (std::size_t offset = 0; offset < size; offset = Replay::skipGame(data, size, offset)) {
+		offsets.push_back(offset);
+	}
+	offsets.push_back(size);
+
+	Report report = run(offsets.size() - 1, [&](std::size_t i, Games& games, std::uint64_t& ticks) {
+		std::size_t offset = offsets[i];
+		try {
+			Replay::decodeGame(data, offsets[i + 1], offset, games.replay);
+		}
+		catch (const std::runtime_error&) {
+			return Verdict::Malformed;
+		}
+		if (offset != offsets[i + 1]) {
+			return Verdict::Malformed;
+		}
+		return validate(games.replay, games, ticks);
+	});
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	report.seconds = elapsed.count();
+	return report;
+}
+
+/**
+	Checks one replay on the calling thread
+
+	@param replay Submitted game
+	@return verdict
+*/
+ReplayValidator::Verdict ReplayValidator::validate(const Replay& replay) const
+{
+	Games games;
+	std::uint64_t ticks = 0;
+	return validate(replay, games, ticks);
+}
+
+/**
+	Returns the name of a verdict, for reports
+
+	@param verdict Verdict
+	@return name
+*/
+const char* ReplayValidator::getName(Verdict verdict)
+{
+	switch (verdict) {
+	case Verdict::Accepted:		return "accepted";
+	case Verdict::Incomplete:	return "incomplete";
+	case Verdict::BadGrid:		return "bad grid";
+	case Verdict::BadSpeed:		return "bad speed";
+	case Verdict::Malformed:	return "malformed";
+	case Verdict::TooLong:		return "too long";
+	case Verdict::Mismatch:		return "mismatch";
+	default:					return "?";
+	}
+}
+
+/**
+	Calls validate(item, games, ticks) for items 0 to count - 1 on every core
+
+	@param count Number of replays
+	@param validate Checks a replay with a thread's games and adds the ticks it played
+	@return verdicts and totals
+*/
+template<typename Validate>
+ReplayValidator::Report ReplayValidator::run(std::size_t count, const Validate& validate) const
+{
+	Report report;
+	report.verdicts.resize(count, Verdict::Accepted);
+	const std::size_t nChunks = (count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+	int nThreads = settings.threads > 0 ? settings.threads : int(std::thread::hardware_concurrency());
+	nThreads = int(std::max<std::size_t>(1, std::min<std::size_t>(std::size_t(nThreads), nChunks)));
+
+	std::atomic<std::size_t> nextChunk{ 0 };
+	std::mutex merge;
+	const auto work = [&]() {
+		Games games;
+		std::uint64_t localAccepted = 0;
+		std::uint64_t localTicks = 0;
+		for (std::size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < nChunks;
+			chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+			const std::size_t end = std::min(count, (chunk + 1) * CHUNK_SIZE);
+			for (std::size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+				report.verdicts[i] = validate(i, games, localTicks);
+				localAccepted += report.verdicts[i] == Verdict::Accepted;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(merge);
+		report.accepted += localAccepted;
+		report.ticks += localTicks;
+	};
+
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int t = 1; t < nThreads; ++t) {
+		threads.emplace_back(work);
+	}
+	work();
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	report.threads = nThreads;
+	report.seconds = elapsed.count();
+	return report;
+}
+
+/**
+	Looks for what makes a replay illegitimate or too costly to play again, without playing it
+
+	@param replay Submitted game
+	@return Verdict::Accepted if it can be played
+*/
+ReplayValidator::Verdict ReplayValidator::check(const Replay& replay) const
+{
+	if (!replay.isComplete) {
+		return Verdict::Incomplete;
+	}
+	const Replay::Header& header = replay.header;
+	if (header.width < 2 || header.height < 1 || int(header.width) * header.height > settings.maxCells) {
+		return Verdict::BadGrid;
+	}
+	if (!isSpeedLevel(header.speedLevel)) {
+		return Verdict::BadSpeed;
+	}
+	if (replay.finalTick > settings.maxTicks) {
+		return Verdict::TooLong;
+	}
+	for (const Replay::Event& event : replay.events) {
+		if (event.tick > replay.finalTick) {
+			return Verdict::Malformed;
+		}
+		if (event.action == SimulationBase::Action::None && !isSpeedLevel(event.speedLevel)) {
+			return Verdict::BadSpeed;
+		}
+	}
+	return Verdict::Accepted;
+}
+
+ReplayValidator::Verdict ReplayValidator::validate(const Replay& replay, Games& games, std::uint64_t& ticks) const
+{
+	const Verdict verdict = check(replay);
+	if (verdict != Verdict::Accepted) {
+		return verdict;
+	}
+	bool matches;
+	if (replay.header.width == Grid::CLASSIC_WIDTH && replay.header.height == Grid::CLASSIC_HEIGHT) {
+		replay.play(games.classic);
+		matches = replay.matches(games.classic);
+		ticks += games.classic.getTick();
+	}
+	else {
+		if (!games.other || games.other->getGrid().getWidth() != replay.header.width || games.other->getGrid().getHeight() != replay.header.height) {
+			games.other.reset(new Simulation(Grid(replay.header.width, replay.header.height)));
+		}
+		replay.play(*games.other);
+		matches = replay.matches(*games.other);
+		ticks += games.other->getTick();
+	}
+	return matches ? Verdict::Accepted : Verdict::Mismatch;
+}
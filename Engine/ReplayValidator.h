@@ -0,0 +1,82 @@
+/**
+	Checks the scores claimed by submitted games: every replay is played again with the game rules and accepted
+	only if it ends on the tick and with the score it claims. The client computes the score it saves, so only
+	a replayed score can be trusted
+	Replays are refused before they are played when they can't be legitimate or would cost too much to play:
+	no end record, a grid too small or too big, a speed level the menu doesn't offer, actions after the end,
+	or more ticks than maxTicks
+
+	Replays are handed out to every core in chunks from a shared counter; each verdict is written to its replay's slot,
+	and every thread adds its counts to the shared totals once. A recording in Replay's format (e.g. a mapped file)
+	is checked without decoding it whole: one pass steps over the records to find where its games start, then each
+	thread decodes its own games into a replay it reuses, so memory only grows with the number of games. A game which
+	can't be decoded is refused on its own, the others are still checked
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Replay.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class ReplayValidator {
+public:
+	enum class Verdict {
+		Accepted,
+		Incomplete,		// No end record, nothing is claimed
+		BadGrid,
+		BadSpeed,
+		Malformed,		// Can't be decoded, or actions after the end
+		TooLong,
+		Mismatch		// Replayed game doesn't end on the claimed tick with the claimed score
+	};
+
+	struct Settings {
+		int threads = 0;						// 0 uses every hardware thread
+		std::uint64_t maxTicks = 10000000;		// Longest game played again
+		int maxCells = 256 * 256;				// Largest grid accepted
+	};
+
+	struct Report {
+		std::vector<Verdict> verdicts;			// Per replay, in order
+		std::uint64_t accepted = 0;
+		std::uint64_t ticks = 0;				// Ticks played again
+		int threads = 0;
+		double seconds = 0.0;
+	};
+
+public:
+	explicit ReplayValidator(const Settings& settings);
+	Report validate(const std::vector<Replay>& replays) const;
+	Report validate(const std::uint8_t* data, std::size_t size) const;
+	Verdict validate(const Replay& replay) const;
+
+	static const char* getName(Verdict verdict);
+
+public:
+	static constexpr int VERDICTS = 7;
+
+private:
+	/**
+		Games of one thread, the classic grid is played on a GameState, other grids on a Simulation of their size
+	*/
+	struct Games {
+		GameState classic;
+		std::unique_ptr<Simulation> other;
+		Replay replay;							// Decoded from a recording
+	};
+
+private:
+	template<typename Validate>
+	Report run(std::size_t count, const Validate& validate) const;
+	Verdict check(const Replay& replay) const;
+	Verdict validate(const Replay& replay, Games& games, std::uint64_t& ticks) const;
+
+private:
+	Settings settings;
+};
@@ -0,0 +1,122 @@
+/**
+	Body of the snake stored as the location of every segment in a RingBuffer, with the same interface as PackedBody
+	The body representation of builds with SNEK_RING_BUFFER_BODY (CMake option of the same name): a segment takes
+	a Vec2_<int> (8 bytes) instead of a 2-bit link, so copies of the snake are far bigger (see snek_bench_packed_body),
+	but any segment location is read in constant time instead of being decoded from the head
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "RingBuffer.h"
+#include "Vec2.h"
+#include <iterator>
+#include <stdlib.h>
+#include <assert.h>
+
+template<int CAPACITY>
+class RingBody {
+public:
+	/**
+		Walks the segments from the head to the tail
+	*/
+	class Iterator {
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = Vec2_<int>;
+		using difference_type = int;
+		using pointer = const Vec2_<int>*;
+		using reference = const Vec2_<int>&;
+
+		Iterator(const RingBody* body, int index)
+			:
+			body(body),
+			index(index)
+		{}
+		const Vec2_<int>& operator*() const
+		{
+			return body->locations[index];
+		}
+		const Vec2_<int>* operator->() const
+		{
+			return &body->locations[index];
+		}
+		Iterator& operator++()
+		{
+			++index;
+			return *this;
+		}
+		Iterator operator++(int)
+		{
+			Iterator old = *this;
+			++*this;
+			return old;
+		}
+		bool operator==(const Iterator& rhs) const
+		{
+			return index == rhs.index;
+		}
+		bool operator!=(const Iterator& rhs) const
+		{
+			return index != rhs.index;
+		}
+
+	private:
+		const RingBody* body;
+		int index;				// Index of the segment, 0 being the head
+	};
+
+public:
+	RingBody(int cellCount)
+		:
+		locations(cellCount)
+	{}
+	void reset(Vec2_<int> location)	// One segment
+	{
+		locations.clear();
+		locations.pushBack(location);
+	}
+	void pushFront(Vec2_<int> dir)	// New head next to the current one, in direction dir
+	{
+		locations.pushFront(locations.front() + dir);
+	}
+	void pushBack(Vec2_<int> location)	// New tail next to the current one
+	{
+		assert(abs(back().x - location.x) + abs(back().y - location.y) == 1);
+		locations.pushBack(location);
+	}
+	void popBack()
+	{
+		assert(locations.size() > 1);
+		locations.popBack();
+	}
+	Vec2_<int> front() const
+	{
+		return locations.front();
+	}
+	Vec2_<int> back() const
+	{
+		return locations.back();
+	}
+	Vec2_<int> operator[](int index) const	// 0 is the head
+	{
+		return locations[index];
+	}
+	Iterator begin() const
+	{
+		return Iterator(this, 0);
+	}
+	Iterator end() const
+	{
+		return Iterator(this, size());
+	}
+	int size() const
+	{
+		return locations.size();
+	}
+
+private:
+	RingBuffer<Vec2_<int>, CAPACITY> locations;	// Front is the head
+};
@@ -0,0 +1,89 @@
+/**
+	Fixed-capacity circular buffer. Items can be added / removed at both ends in constant time
+	without moving the other items. Stored in a std::array for a compile time CAPACITY,
+	or allocated once, on construction, for DYNAMIC_CAPACITY
+
+	@author Benjamin Korady
+	@version 1.2	17/10/2026
+*/
+
+#pragma once
+
+#include "Storage.h"
+#include <assert.h>
+
+template<typename T, int CAPACITY>
+class RingBuffer {
+public:
+	RingBuffer(int capacity)
+		:
+		items(Storage<T, CAPACITY>::make(capacity))
+	{}
+	void pushFront(const T& item)
+	{
+		assert(count < getCapacity());
+		first = first == 0 ? getCapacity() - 1 : first - 1;
+		items[first] = item;
+		++count;
+	}
+	void pushBack(const T& item)
+	{
+		assert(count < getCapacity());
+		items[wrap(first + count)] = item;
+		++count;
+	}
+	void popFront()
+	{
+		assert(count > 0);
+		first = wrap(first + 1);
+		--count;
+	}
+	void popBack()
+	{
+		assert(count > 0);
+		--count;
+	}
+	void clear()
+	{
+		first = 0;
+		count = 0;
+	}
+	const T& front() const
+	{
+		assert(count > 0);
+		return items[first];
+	}
+	const T& back() const
+	{
+		assert(count > 0);
+		return items[wrap(first + count - 1)];
+	}
+	const T& operator[](int index) const	// 0 is the front
+	{
+		assert(index >= 0 && index < count);
+		return items[wrap(first + index)];
+	}
+	int size() const
+	{
+		return count;
+	}
+	bool empty() const
+	{
+		return count == 0;
+	}
+	int getCapacity() const
+	{
+		return (int)items.size();
+	}
+
+private:
+	int wrap(int index) const
+	{
+		return index >= getCapacity() ? index - getCapacity() : index;
+	}
+
+private:
+	typename Storage<T, CAPACITY>::Type items;
+	int first = 0;
+	int count = 0;
+};
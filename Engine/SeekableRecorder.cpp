@@ -0,0 +1,182 @@
+#include "SeekableRecorder.h"
+#include "Replay.h"
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <assert.h>
+
+template<typename GridType>
+constexpr std::size_t BasicSeekableRecorder<GridType>::FLUSH_SIZE;
+
+/**
+	Creates the file and stores the game's header and a first keyframe
+
+	@param path File to write, replaced if it exists
+	@param sim Game to record, usually just reset
+	@param keyframeInterval Ticks between keyframes, at least 1
+*/
+template<typename GridType>
+BasicSeekableRecorder<GridType>::BasicSeekableRecorder(const std::string& path, const BasicSimulation<GridType>& sim, std::uint32_t keyframeInterval)
+	:
+	file(path, std::ios::binary | std::ios::trunc),
+	keyframeInterval(keyframeInterval),
+	nextKeyframeTick(sim.getTick()),
+	lastTick(sim.getTick()),
+	speedLevel(sim.getSnake().getSpeed())
+{
+	static_assert(std::is_trivially_copyable<BasicSimulation<GridType>>::value, "Keyframes are the bytes of the game state");
+	assert(keyframeInterval > 0);
+	if (!file) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	FileHeader header = {};
+	std::memcpy(header.magic, HEADER_MAGIC, sizeof(HEADER_MAGIC));
+	header.version = VERSION;
+	header.width = std::uint16_t(sim.getGrid().getWidth());
+	header.height = std::uint16_t(sim.getGrid().getHeight());
+	header.speedLevel = std::uint8_t(speedLevel);
+	header.stateSize = std::uint32_t(sizeof(BasicSimulation<GridType>));
+	header.keyframeInterval = keyframeInterval;
+	header.seed = sim.getSeed();
+	const std::uint8_t* const bytes = reinterpret_cast<const std::uint8_t*>(&header);
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(header));
+	recordTick(sim);
+}
+
+/**
+	Writes what is buffered. A recording that wasn't finished has no index and can't be read
+*/
+template<typename GridType>
+BasicSeekableRecorder<GridType>::~BasicSeekableRecorder()
+{
+	flush();
+}
+
+/**
+	Stores a keyframe when it is due, call it before the actions of every tick
+
+	@param sim Game being recorded
+*/
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::recordTick(const BasicSimulation<GridType>& sim)
+{
+	if (sim.getTick() >= nextKeyframeTick) {
+		writeKeyframe(sim);
+		nextKeyframeTick = sim.getTick() + keyframeInterval;
+	}
+}
+
+/**
+	Records an action queued on the game
+
+	@param tick Steps the game has taken so far
+	@param action Action::Up to Action::Right
+*/
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::recordAction(std::uint64_t tick, SimulationBase::Action action)
+{
+	assert(!isFinished && tick >= lastTick);
+	Replay::writeEvent(buffer, tick - lastTick, action);
+	lastTick = tick;
+	if (buffer.size() >= FLUSH_SIZE) {
+		flush();
+	}
+}
+
+/**
+	Records the game's speed level if it changed since the last record
+
+	@param tick Steps the game has taken so far
+	@param newSpeedLevel Speed level of the game
+*/
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::recordSpeed(std::uint64_t tick, int newSpeedLevel)
+{
+	assert(!isFinished && tick >= lastTick);
+	if (newSpeedLevel != speedLevel) {
+		Replay::writeSpeed(buffer, tick - lastTick, newSpeedLevel);
+		lastTick = tick;
+		speedLevel = newSpeedLevel;
+	}
+}
+
+/**
+	Records the end of the game, writes the index of the keyframes and closes the file
+	Throws std::runtime_error if the file couldn't be written
+
+	@param tick Steps the game took
+	@param score Final score
+*/
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::finish(std::uint64_t tick, int score)
+{
+	assert(!isFinished && tick >= lastTick);
+	Replay::writeEnd(buffer, tick - lastTick, score);
+	pad();
+	Footer footer = {};
+	footer.indexOffset = getSize();
+	footer.keyframeCount = index.size();
+	footer.finalTick = tick;
+	footer.finalScore = score;
+	std::memcpy(footer.magic, FOOTER_MAGIC, sizeof(FOOTER_MAGIC));
+	const std::uint8_t* const entries = reinterpret_cast<const std::uint8_t*>(index.data());
+	buffer.insert(buffer.end(), entries, entries + index.size() * sizeof(IndexEntry));
+	const std::uint8_t* const bytes = reinterpret_cast<const std::uint8_t*>(&footer);
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(footer));
+	flush();
+	file.close();
+	isFinished = true;
+	if (!file) {
+		throw std::runtime_error("Couldn't write the seekable replay");
+	}
+}
+
+/**
+	Returns the number of bytes recorded so far, written or buffered
+
+	@return size in bytes
+*/
+template<typename GridType>
+std::uint64_t BasicSeekableRecorder<GridType>::getSize() const
+{
+	return written + buffer.size();
+}
+
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::writeKeyframe(const BasicSimulation<GridType>& sim)
+{
+	assert(!isFinished && sim.getTick() >= lastTick);
+	Replay::writeVarint(buffer, (sim.getTick() - lastTick) << 3 | Replay::KEYFRAME);
+	pad();
+	index.push_back({ sim.getTick(), getSize() });
+	const std::uint8_t* const bytes = reinterpret_cast<const std::uint8_t*>(&sim);
+	buffer.insert(buffer.end(), bytes, bytes + sizeof(sim));
+	lastTick = sim.getTick();
+	if (buffer.size() >= FLUSH_SIZE) {
+		flush();
+	}
+}
+
+/**
+	Appends zeros up to the next multiple of ALIGNMENT bytes
+*/
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::pad()
+{
+	buffer.resize(buffer.size() + std::size_t((ALIGNMENT - getSize() % ALIGNMENT) % ALIGNMENT), 0);
+}
+
+template<typename GridType>
+void BasicSeekableRecorder<GridType>::flush()
+{
+	if (!buffer.empty() && file.is_open()) {
+		file.write(reinterpret_cast<const char*>(buffer.data()), std::streamsize(buffer.size()));
+		written += buffer.size();
+		buffer.clear();
+	}
+}
+
+template class BasicSeekableRecorder<ClassicGrid>;
+template class BasicSeekableRecorder<MediumGrid>;
+template class BasicSeekableRecorder<LargeGrid>;
+template class BasicSeekableRecorder<HugeGrid>;
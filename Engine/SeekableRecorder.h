@@ -0,0 +1,51 @@
+/**
+	Records one game into a seekable replay file (see SeekableReplay for the format): the game's actions and speed changes
+	as in a Replay, plus a keyframe of the whole game state every keyframeInterval ticks and the index of the keyframes
+	when the recording finishes. Shorter intervals make seeks faster and files bigger
+	Records are buffered and written in large blocks; nothing written earlier is read again
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "SeekableReplay.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+template<typename GridType>
+class BasicSeekableRecorder : public SeekableReplayBase {
+public:
+	BasicSeekableRecorder(const std::string& path, const BasicSimulation<GridType>& sim, std::uint32_t keyframeInterval = 4096);
+	BasicSeekableRecorder(const BasicSeekableRecorder&) = delete;
+	BasicSeekableRecorder& operator=(const BasicSeekableRecorder&) = delete;
+	~BasicSeekableRecorder();
+
+	void recordTick(const BasicSimulation<GridType>& sim);
+	void recordAction(std::uint64_t tick, SimulationBase::Action action);
+	void recordSpeed(std::uint64_t tick, int speedLevel);
+	void finish(std::uint64_t tick, int score);
+	std::uint64_t getSize() const;
+
+private:
+	void writeKeyframe(const BasicSimulation<GridType>& sim);
+	void pad();
+	void flush();
+
+private:
+	static constexpr std::size_t FLUSH_SIZE = 1 << 16;	// Bytes buffered before they are written
+	std::ofstream file;
+	std::vector<std::uint8_t> buffer;		// Bytes not written yet
+	std::uint64_t written = 0;				// Bytes written before the buffer's
+	std::vector<IndexEntry> index;
+	std::uint32_t keyframeInterval;
+	std::uint64_t nextKeyframeTick;
+	std::uint64_t lastTick;					// Tick of the last record or keyframe
+	int speedLevel;							// Speed level of the game as recorded so far
+	bool isFinished = false;
+};
+
+using SeekableRecorder = BasicSeekableRecorder<ClassicGrid>;
@@ -0,0 +1,179 @@
+#include "SeekableReplay.h"
+#include "Replay.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <assert.h>
+
+constexpr std::uint32_t SeekableReplayBase::VERSION;
+constexpr std::size_t SeekableReplayBase::ALIGNMENT;
+const char SeekableReplayBase::HEADER_MAGIC[4] = { 'S', 'N', 'K', 'S' };
+const char SeekableReplayBase::FOOTER_MAGIC[8] = { 'S', 'N', 'K', 'S', 'I', 'D', 'X', '1' };
+
+/**
+	Maps a recording and checks its header and footer
+	Throws std::runtime_error if the file can't be mapped, isn't a finished recording, or was written for another
+	grid or by a build with another layout of the game state
+
+	@param path File of the recording
+*/
+template<typename GridType>
+BasicSeekableReplay<GridType>::BasicSeekableReplay(const std::string& path)
+	:
+	file(path),
+	data(static_cast<const std::uint8_t*>(file.getData()))
+{
+	static_assert(std::is_trivially_copyable<BasicSimulation<GridType>>::value, "Keyframes are the bytes of the game state");
+	static_assert(alignof(BasicSimulation<GridType>) <= ALIGNMENT, "Keyframes are read in place");
+
+	const std::size_t size = file.getSize();
+	if (size < sizeof(FileHeader) + sizeof(Footer) || std::memcmp(data, HEADER_MAGIC, sizeof(HEADER_MAGIC)) != 0) {
+		throw std::runtime_error(path + " isn't a seekable replay");
+	}
+	header = reinterpret_cast<const FileHeader*>(data);
+	footer = reinterpret_cast<const Footer*>(data + size - sizeof(Footer));
+	if (header->version != VERSION) {
+		throw std::runtime_error("Seekable replay version " + std::to_string(header->version) + " isn't supported");
+	}
+	const GridType grid;
+	if (header->width != grid.getWidth() || header->height != grid.getHeight() || header->stateSize != sizeof(BasicSimulation<GridType>)) {
+		throw std::runtime_error(path + " was recorded on another grid or by another build");
+	}
+	if (std::memcmp(footer->magic, FOOTER_MAGIC, sizeof(FOOTER_MAGIC)) != 0) {
+		throw std::runtime_error(path + " has no index, its recording didn't finish");
+	}
+	const std::uint64_t indexEnd = size - sizeof(Footer);
+	if (footer->keyframeCount == 0 || footer->indexOffset % ALIGNMENT != 0 || footer->indexOffset > indexEnd
+		|| footer->keyframeCount > (indexEnd - footer->indexOffset) / sizeof(IndexEntry)) {
+		throw std::runtime_error(path + " has a broken index");
+	}
+	index = reinterpret_cast<const IndexEntry*>(data + footer->indexOffset);
+}
+
+/**
+	Puts a game in the state the recorded game was in after a number of steps, before the actions of the next one:
+	copies the last keyframe stored at or before that tick and plays the recorded actions up to it
+	Seeking past the end (or before the first keyframe) gives the final state (or the first keyframe)
+
+	@param tick Steps taken
+	@param sim Receives the game
+*/
+template<typename GridType>
+void BasicSeekableReplay<GridType>::seek(std::uint64_t tick, BasicSimulation<GridType>& sim) const
+{
+	const IndexEntry* const end = index + footer->keyframeCount;
+	const IndexEntry* keyframe = std::upper_bound(index, end, tick,
+		[](std::uint64_t target, const IndexEntry& entry) { return target < entry.tick; });
+	if (keyframe != index) {
+		--keyframe;
+	}
+	sim = getKeyframe(std::size_t(keyframe - index));
+
+	const std::size_t recordsEnd = std::size_t(footer->indexOffset);
+	std::size_t offset = std::size_t(keyframe->offset) + sizeof(BasicSimulation<GridType>);
+	std::uint64_t recordTick = keyframe->tick;
+	while (offset < recordsEnd) {
+		const std::uint64_t record = Replay::readVarint(data, recordsEnd, offset);
+		recordTick += record >> 3;
+		const int kind = int(record & 7);
+		if (kind == Replay::END || recordTick >= tick) {
+			break;
+		}
+		while (sim.getTick() < recordTick && !sim.isGameOver()) {
+			sim.step();
+		}
+		if (kind < 4) {
+			sim.queueAction(SimulationBase::Action(kind + 1));
+		}
+		else if (kind == Replay::SPEED && offset < recordsEnd) {
+			sim.getSnake().setSpeed(data[offset++]);
+		}
+		else if (kind == Replay::KEYFRAME) {
+			offset = (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT + sizeof(BasicSimulation<GridType>);
+		}
+		else {
+			throw std::runtime_error("Seekable replay has an unknown record kind at byte " + std::to_string(offset));
+		}
+	}
+	while (sim.getTick() < tick && sim.getTick() < footer->finalTick && !sim.isGameOver()) {
+		sim.step();
+	}
+}
+
+/**
+	Returns a keyframe where it lies in the mapped file, nothing is copied
+
+	@param number Keyframe number, in order of ticks
+	@return game state, valid while the replay is open
+*/
+template<typename GridType>
+const BasicSimulation<GridType>& BasicSeekableReplay<GridType>::getKeyframe(std::size_t number) const
+{
+	assert(number < footer->keyframeCount);
+	const std::uint64_t offset = index[number].offset;
+	if (offset % ALIGNMENT != 0 || offset > footer->indexOffset || footer->indexOffset - offset < sizeof(BasicSimulation<GridType>)) {
+		throw std::runtime_error("Seekable replay has a keyframe outside its records");
+	}
+	return *reinterpret_cast<const BasicSimulation<GridType>*>(data + offset);
+}
+
+/**
+	Returns the number of keyframes
+
+	@return count
+*/
+template<typename GridType>
+std::size_t BasicSeekableReplay<GridType>::getKeyframeCount() const
+{
+	return std::size_t(footer->keyframeCount);
+}
+
+/**
+	Returns the header: grid size, speed level, seed and keyframe interval
+
+	@return header
+*/
+template<typename GridType>
+const SeekableReplayBase::FileHeader& BasicSeekableReplay<GridType>::getHeader() const
+{
+	return *header;
+}
+
+/**
+	Returns the number of steps the recorded game took
+
+	@return tick
+*/
+template<typename GridType>
+std::uint64_t BasicSeekableReplay<GridType>::getFinalTick() const
+{
+	return footer->finalTick;
+}
+
+/**
+	Returns the recorded game's final score
+
+	@return score
+*/
+template<typename GridType>
+int BasicSeekableReplay<GridType>::getFinalScore() const
+{
+	return int(footer->finalScore);
+}
+
+/**
+	Returns the size of the file
+
+	@return bytes
+*/
+template<typename GridType>
+std::size_t BasicSeekableReplay<GridType>::getSize() const
+{
+	return file.getSize();
+}
+
+template class BasicSeekableReplay<ClassicGrid>;
+template class BasicSeekableReplay<MediumGrid>;
+template class BasicSeekableReplay<LargeGrid>;
+template class BasicSeekableReplay<HugeGrid>;
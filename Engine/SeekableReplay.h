@@ -0,0 +1,85 @@
+/**
+	Recording of one long game that can be watched from any tick without playing it from the start: every few ticks
+	the recorder (see SeekableRecorder) stores the whole game state as a keyframe, and an index of the keyframes
+	follows the game. The reader maps the file into memory, finds the last keyframe before a tick in the index,
+	copies it and plays the few ticks after it, so a seek costs the same on a file of any length
+
+	Format, a game of one grid preset (BasicSimulation<GridType> is trivially copyable for the FixedGrid presets only):
+		header		FileHeader: "SNKS", version, grid size, speed level, size of a keyframe, keyframe interval, seed
+		records		Replay's action, speed and end records, ticks counted from the previous record or keyframe
+		keyframe	varint (ticks since the previous record << 3 | Replay::KEYFRAME), zeros up to a multiple of 8 bytes,
+					then the bytes of the game state taken before the actions of its tick
+		index		zeros up to a multiple of 8 bytes, then an IndexEntry for every keyframe by tick
+		footer		Footer: offset of the index, number of keyframes, final tick and score, "SNKSIDX1"
+	The header, keyframes and index are read in place, so they are in the byte order and layout of the build that wrote them;
+	a file from a build with another layout of the game state is refused. A file whose recording didn't finish has no footer
+	and can't be opened
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+#include "MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+class SeekableReplayBase {
+public:
+	struct FileHeader {
+		char magic[4];
+		std::uint32_t version;
+		std::uint16_t width;
+		std::uint16_t height;
+		std::uint8_t speedLevel;
+		std::uint8_t padding[3];
+		std::uint32_t stateSize;		// sizeof the game state, checked when reading
+		std::uint32_t keyframeInterval;	// Ticks between keyframes
+		std::uint64_t seed;
+	};
+
+	struct IndexEntry {
+		std::uint64_t tick;				// Steps taken when the keyframe was stored
+		std::uint64_t offset;			// Byte of the file the game state starts at
+	};
+
+	struct Footer {
+		std::uint64_t indexOffset;
+		std::uint64_t keyframeCount;
+		std::uint64_t finalTick;
+		std::int64_t finalScore;
+		char magic[8];
+	};
+
+public:
+	static constexpr std::uint32_t VERSION = 1;
+	static constexpr std::size_t ALIGNMENT = 8;	// Of keyframes and of the index
+	static const char HEADER_MAGIC[4];
+	static const char FOOTER_MAGIC[8];
+};
+
+template<typename GridType>
+class BasicSeekableReplay : public SeekableReplayBase {
+public:
+	explicit BasicSeekableReplay(const std::string& path);
+
+	void seek(std::uint64_t tick, BasicSimulation<GridType>& sim) const;
+	const BasicSimulation<GridType>& getKeyframe(std::size_t index) const;
+	std::size_t getKeyframeCount() const;
+	const FileHeader& getHeader() const;
+	std::uint64_t getFinalTick() const;
+	int getFinalScore() const;
+	std::size_t getSize() const;
+
+private:
+	MappedFile file;
+	const std::uint8_t* data;
+	const FileHeader* header;
+	const IndexEntry* index;
+	const Footer* footer;
+};
+
+using SeekableReplay = BasicSeekableReplay<ClassicGrid>;
@@ -0,0 +1,308 @@
+#include "Simulation.h"
+#include <stdexcept>
+#include <string>
+#include <assert.h>
+
+/**
+	Constructs the simulation with a snake and food in their starting positions
+	All memory is allocated here, so steps and resets don't allocate
+
+	@param grid Grid the game is played on (a default constructed Grid is the classic 20x11 grid)
+	@param seed Seed of the first game, see reset(seed)
+*/
+template<typename GridType>
+BasicSimulation<GridType>::BasicSimulation(const GridType& grid, std::uint64_t seed)
+	:
+	grid(grid),
+	snek(grid),
+	nom(grid, seed)
+{
+	reset(seed);
+}
+
+/**
+	Restarts the game with the seed of the current one, so the same moves replay the same game
+*/
+template<typename GridType>
+void BasicSimulation<GridType>::reset()
+{
+	reset(getSeed());
+}
+
+/**
+	Resets the snake, food, score and tick counter back to default values
+	The snake's speed level is kept
+
+	@param seed Seed of the food placement. Games with the same seed and the same actions play out the same
+*/
+template<typename GridType>
+void BasicSimulation<GridType>::reset(std::uint64_t seed)
+{
+	snek.reset();
+	nom.reset(snek, seed);
+	score = 0;
+	gameOver = false;
+	won = false;
+	tick = 0;
+	checkHash();
+}
+
+/**
+	Queues a change of direction to be used by one of the following steps
+
+	@param action Direction to turn to, Action::None is ignored
+*/
+template<typename GridType>
+void BasicSimulation<GridType>::queueAction(Action action)
+{
+	if (action != Action::None) {
+		snek.queueDirection(toDirection(action));
+	}
+}
+
+/**
+	Advances the game by one tick: moves the snake, checks for collisions with the walls and the snake's body,
+	and grows the snake / respawns the food / adds to the score when the food is eaten
+
+	@param action Optional action to queue before the step is taken
+	@return Outcome what happened during the step. Returns Outcome::Died / Outcome::Won without advancing if the game is already over
+*/
+template<typename GridType>
+SimulationBase::Outcome BasicSimulation<GridType>::step(Action action)
+{
+	if (gameOver) {
+		return won ? Outcome::Won : Outcome::Died;
+	}
+
+	queueAction(action);
+	++tick;
+
+	if (snek.getDirection() == Vec2_<int>(DIR_ZERO)) {
+		return Outcome::Idle;	// Snake doesn't move until it is given its first direction
+	}
+
+	const Vec2_<int> nextLocation = snek.getNextHeadLocation();				// Check where snake is about to go in its next step
+	if (!grid.isInside(nextLocation) || snek.isInTile(nextLocation)) {		// Snake collides with a wall / body
+		gameOver = true;
+		return Outcome::Died;
+	}
+
+	const bool eats = nextLocation == nom.getLocation();	// Snake is about to eat food
+	if (eats) {
+		snek.grow();
+	}
+
+	if (BasicFood<GridType>::HAS_FREE_TILES && !snek.isGrowing()) {	// Keep the food's free tiles in sync with the snake
+		nom.markFree(snek.getTailLocation());
+	}
+	snek.move();
+	if (BasicFood<GridType>::HAS_FREE_TILES) {
+		nom.markOccupied(nextLocation);
+	}
+
+	checkHash();
+	if (!eats) {
+		return Outcome::Moved;
+	}
+	score += snek.getSpeed();
+	if (!nom.respawn(snek)) {	// No free tile left for the food
+		gameOver = true;
+		won = true;
+		return Outcome::Won;
+	}
+	checkHash();
+	return Outcome::Ate;
+}
+
+/**
+	Snake getter
+
+	@return snek
+*/
+template<typename GridType>
+const BasicSnake<GridType> & BasicSimulation<GridType>::getSnake() const
+{
+	return snek;
+}
+
+/**
+	Snake getter, used to change the snake's speed level from the menu
+
+	@return snek
+*/
+template<typename GridType>
+BasicSnake<GridType> & BasicSimulation<GridType>::getSnake()
+{
+	return snek;
+}
+
+/**
+	Food getter
+
+	@return nom
+*/
+template<typename GridType>
+const BasicFood<GridType> & BasicSimulation<GridType>::getFood() const
+{
+	return nom;
+}
+
+/**
+	Food getter
+
+	@return nom
+*/
+template<typename GridType>
+BasicFood<GridType> & BasicSimulation<GridType>::getFood()
+{
+	return nom;
+}
+
+/**
+	Returns the score of the current game
+
+	@return score
+*/
+template<typename GridType>
+int BasicSimulation<GridType>::getScore() const
+{
+	return score;
+}
+
+/**
+	States whether or not the snake has collided with a wall or its own body
+
+	@return bool
+*/
+template<typename GridType>
+bool BasicSimulation<GridType>::isGameOver() const
+{
+	return gameOver;
+}
+
+/**
+	States whether or not the game ended by the snake filling the whole board
+
+	@return bool
+*/
+template<typename GridType>
+bool BasicSimulation<GridType>::isWon() const
+{
+	return won;
+}
+
+/**
+	Returns the number of steps taken since the last reset
+
+	@return tick
+*/
+template<typename GridType>
+std::uint64_t BasicSimulation<GridType>::getTick() const
+{
+	return tick;
+}
+
+/**
+	Returns the seed the current game was started with
+
+	@return seed
+*/
+template<typename GridType>
+std::uint64_t BasicSimulation<GridType>::getSeed() const
+{
+	return nom.getSeed();
+}
+
+/**
+	Returns the grid the game is played on
+
+	@return grid
+*/
+template<typename GridType>
+const GridType & BasicSimulation<GridType>::getGrid() const
+{
+	return grid;
+}
+
+/**
+	Returns the Zobrist hash of the game (see Zobrist.h): covered tiles, head, direction and food
+	Kept up to date by the snake and the food as they change, so reading it costs nothing
+
+	@return hash, equal for games in the same position
+*/
+template<typename GridType>
+std::uint64_t BasicSimulation<GridType>::getHash() const
+{
+	return snek.getHash() ^ nom.getHash();
+}
+
+/**
+	Computes the Zobrist hash of the game from scratch, the reference getHash is checked against
+
+	@return hash
+*/
+template<typename GridType>
+std::uint64_t BasicSimulation<GridType>::computeHash() const
+{
+	return snek.computeHash() ^ nom.computeHash();
+}
+
+/**
+	Throws std::runtime_error if the hash kept up to date differs from a full recompute
+	Only checks in builds with SNEK_CHECK_HASH, otherwise it does nothing
+*/
+template<typename GridType>
+void BasicSimulation<GridType>::checkHash() const
+{
+#ifdef SNEK_CHECK_HASH
+	if (getHash() != computeHash()) {
+		throw std::runtime_error("Game hash is out of sync after tick " + std::to_string(tick));
+	}
+#endif
+}
+
+/**
+	Converts an action to a directional vector
+
+	@param action
+	@return direction, DIR_ZERO for Action::None
+*/
+Vec2_<int> SimulationBase::toDirection(Action action)
+{
+	switch (action) {
+	case Action::Up:	return { DIR_UP };
+	case Action::Down:	return { DIR_DOWN };
+	case Action::Left:	return { DIR_LEFT };
+	case Action::Right:	return { DIR_RIGHT };
+	default:			return { DIR_ZERO };
+	}
+}
+
+/**
+	Converts a directional vector to an action
+
+	@param direction One of DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT
+	@return action, Action::None for any other vector
+*/
+SimulationBase::Action SimulationBase::toAction(const Vec2_<int>& direction)
+{
+	if (direction == Vec2_<int>(DIR_UP)) {
+		return Action::Up;
+	}
+	else if (direction == Vec2_<int>(DIR_DOWN)) {
+		return Action::Down;
+	}
+	else if (direction == Vec2_<int>(DIR_LEFT)) {
+		return Action::Left;
+	}
+	else if (direction == Vec2_<int>(DIR_RIGHT)) {
+		return Action::Right;
+	}
+	return Action::None;
+}
+
+template class BasicSimulation<Grid>;
+template class BasicSimulation<ClassicGrid>;
+template class BasicSimulation<MediumGrid>;
+template class BasicSimulation<LargeGrid>;
+template class BasicSimulation<HugeGrid>;
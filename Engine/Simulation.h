@@ -0,0 +1,89 @@
+/**
+	Platform independent game rules (snake movement, collisions, food and scoring)
+	advanced one fixed step at a time. Used by the Game and by the headless tools
+
+	BasicSimulation is compiled for the runtime sized Grid (Simulation) and for the FixedGrid presets in Grid.h
+	(e.g. BasicSimulation<ClassicGrid>). Actions and outcomes are shared by all of them through SimulationBase
+
+	@author Benjamin Korady
+	@version 1.2	17/10/2026
+*/
+
+#pragma once
+
+#include "Grid.h"
+#include "Snake.h"
+#include "Food.h"
+#include <cstdint>
+#include <type_traits>
+
+class SimulationBase {
+public:
+	enum class Action {
+		None,
+		Up,
+		Down,
+		Left,
+		Right
+	};
+
+	enum class Outcome {
+		Idle,	// Snake has not been given a direction yet
+		Moved,
+		Ate,
+		Died,
+		Won		// Snake fills the whole board
+	};
+
+public:
+	static Vec2_<int> toDirection(Action action);
+	static Action toAction(const Vec2_<int>& direction);
+};
+
+template<typename GridType>
+class BasicSimulation : public SimulationBase {
+public:
+	BasicSimulation(const GridType& grid = GridType(), std::uint64_t seed = 0);
+
+	void reset();
+	void reset(std::uint64_t seed);
+	void queueAction(Action action);
+	Outcome step(Action action = Action::None);
+
+	const BasicSnake<GridType>& getSnake() const;
+	BasicSnake<GridType>& getSnake();
+	const BasicFood<GridType>& getFood() const;
+	BasicFood<GridType>& getFood();
+	int getScore() const;
+	bool isGameOver() const;
+	bool isWon() const;
+	std::uint64_t getTick() const;
+	std::uint64_t getSeed() const;
+	const GridType& getGrid() const;
+	std::uint64_t getHash() const;
+	std::uint64_t computeHash() const;
+
+private:
+	void checkHash() const;
+
+private:
+	GridType grid;
+	BasicSnake<GridType> snek;
+	BasicFood<GridType> nom;
+	int score = 0;
+	bool gameOver = false;
+	bool won = false;
+	std::uint64_t tick = 0;		// Number of steps taken since the last reset
+};
+
+using Simulation = BasicSimulation<Grid>;
+
+// A whole classic 20x11 game (snake, buffered moves, food, score) as one fixed-size value without pointers or heap memory,
+// so snapshots, arrays of games and save / restore are plain copies (memcpy)
+using GameState = BasicSimulation<ClassicGrid>;
+
+static constexpr std::size_t GAME_STATE_BUDGET = 256;	// bytes
+static_assert(std::is_trivially_copyable<GameState>::value, "GameState has to be copyable with memcpy");
+#ifndef SNEK_RING_BUFFER_BODY	// A RingBody takes 8 bytes per tile, far beyond the budget
+static_assert(sizeof(GameState) <= GAME_STATE_BUDGET, "GameState grew beyond its budget");
+#endif
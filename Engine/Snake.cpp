@@ -1,57 +1,90 @@
 #include "Snake.h"
+#include "Zobrist.h"
 #include <assert.h>
-#include <iterator>
+#include <algorithm>
+#include <cstdlib>
+
+template<typename GridType>
+constexpr int BasicSnake<GridType>::nStartingSegments;
 
 /**
     Constructs the snake object and calls reset() to initialize it to default values
+    Memory for the body is allocated here, once, for a snake covering the whole grid
+
+    @param grid Grid the snake moves on (a default constructed Grid is the classic 20x11 grid)
 */
-Snake::Snake()
+template<typename GridType>
+BasicSnake<GridType>::BasicSnake(const GridType& grid)
+	:
+	grid(grid),
+	segments(grid.getCellCount()),
+	occupancy(grid.getCellCount()),
+	bufferedMoves(MaxBufferedMoves)
 {
 	reset();
 }
 
 /**
 	Initializes snake to default values, resets its segments, buffered moves, and direction
+	The snake starts in the bottom row, with its head on the right (at most 9 segments, fewer on narrow grids)
 */
-void Snake::reset()
+template<typename GridType>
+void BasicSnake<GridType>::reset()
 { 
-	segments.clear();
-    Vec2_<int> loc(nStartingSegments-1, Board::Grid::HEIGHT - 1);	// Initialize from the right-most segment (head)
-	for (int i = 0; i < nStartingSegments; ++i) {
-		segments.push_back(Segment({ loc.x--, loc.y }));
+	occupancy.clear();
+	pendingGrowth = 0;
+	const int nSegments = std::min(nStartingSegments, grid.getWidth());
+    Vec2_<int> loc(nSegments-1, grid.getHeight() - 1);	// Initialize from the right-most segment (head)
+	segments.reset(loc);
+	occupancy.set(grid.toIndex(loc));
+	for (int i = 1; i < nSegments; ++i) {
+		--loc.x;
+		occupancy.set(grid.toIndex(loc));
+		segments.pushBack(loc);
 	}
     direction = {DIR_ZERO};
 	bufferedMoves.clear();
+	hash = computeHash();
 }
 
 /**
     Moves the snake in the next direction in queue
-
-    @param brd Board object reference on which the snake is to move
+    A new head is added in front of the old one and the tail is dropped, unless the snake is growing
 */
-void Snake::move(Board & brd)
+template<typename GridType>
+void BasicSnake<GridType>::move()
 {
-	// First all the segments, except the head, follow the segment in front of them...
-	for (int i = (int)segments.size() - 1; i > 0; --i) {
-		segments[i].follow(segments[i - 1]);
-	}
-
 	Vec2_<int> dir = getNextDirection();	
 	if (!bufferedMoves.empty()) {
-		bufferedMoves.pop_front();	// Pop an element if a direction from the queue was used
+		bufferedMoves.popFront();	// Pop an element if a direction from the queue was used
 	}								// If queue is empty, uses last used direction to move
+	assert(abs(dir.x) + abs(dir.y) == 1);
 
-	segments[0].move(dir, brd);
-	lastMoved = std::chrono::steady_clock::now();	// Timestamp when the snake last moved. The time of the next move will be based on this
+	if (pendingGrowth > 0) {
+		--pendingGrowth;			// Growing snake keeps its tail
+	}
+	else {
+		const int tail = grid.toIndex(segments.back());
+		occupancy.reset(tail);
+		hash ^= Zobrist::getKey(Zobrist::Cell, tail);
+		segments.popBack();
+	}
+
+	const int oldHead = grid.toIndex(segments.front());
+	segments.pushFront(dir);
+	const int newHead = grid.toIndex(segments.front());
+	occupancy.set(newHead);
+	hash ^= Zobrist::getKey(Zobrist::Head, oldHead) ^ Zobrist::getKey(Zobrist::Head, newHead) ^ Zobrist::getKey(Zobrist::Cell, newHead);
 }
 
 /**
-    Grows the snake by 1 segment at the tail.
+    Grows the snake by 1 segment at the tail. The tail stays in place during the next move
+    The covered tiles don't change until then, so neither does the hash: move skips removing the tail from it
 */
-void Snake::grow()
+template<typename GridType>
+void BasicSnake<GridType>::grow()
 {
-	Vec2_<int> lastSegmentLoc = segments.back().getLocation();	
-	segments.push_back(lastSegmentLoc);
+	++pendingGrowth;
 }
 
 /**
@@ -59,10 +92,11 @@ void Snake::grow()
 
     @return The next position of the snake's head
 */
-Vec2_<int> Snake::getNextHeadLocation() const
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getNextHeadLocation() const
 {
 	Vec2_<int> dir = getNextDirection();
-	Vec2_<int> l(segments.front().getLocation());
+	Vec2_<int> l(getHeadLocation());
 	l = l+(dir);
 	return l;
 }
@@ -72,7 +106,8 @@ Vec2_<int> Snake::getNextHeadLocation() const
 	
 	@return direction
 */
-Vec2_<int> Snake::getDirection() const
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getDirection() const
 {
 	return direction;
 }
@@ -82,7 +117,8 @@ Vec2_<int> Snake::getDirection() const
 
 	@return speed level
 */
-int Snake::getSpeed() const
+template<typename GridType>
+int BasicSnake<GridType>::getSpeed() const
 {
 	return speedLevel;
 }
@@ -92,7 +128,8 @@ int Snake::getSpeed() const
 
 	@param speedLevel: Expected values are 1-9, uses default 3 otherwise
 */
-void Snake::setSpeed(int speedLevelIn)
+template<typename GridType>
+void BasicSnake<GridType>::setSpeed(int speedLevelIn)
 {
     switch (speedLevelIn) {
     case 1:
@@ -121,186 +158,201 @@ void Snake::setSpeed(int speedLevelIn)
 	speedLevel = speedLevelIn;
 }
 
-
 /**
-    States whether or not the snake can move (Has enough time passed since the last movement?)
-    The required frames idle are based on the snake's movement speed;
+	Returns the time (in seconds) the snake waits between two moves, based on its speed level
 
-    @return bool is it the snake's turn to move
+	@return movePeriod
 */
-bool Snake::isTurnToMove(std::chrono::steady_clock::time_point now) const
+template<typename GridType>
+float BasicSnake<GridType>::getMovePeriod() const
 {
-    std::chrono::duration<float> diff = now - lastMoved;
-    return diff.count() >= movePeriod;
+	return movePeriod;
 }
 
 /**
-	Returns the next direction which is going to be used
+	Returns the number of segments the snake is made of
 
-	@return direction
+	@return length
 */
-Vec2_<int> Snake::getNextDirection() const
+template<typename GridType>
+int BasicSnake<GridType>::getLength() const
 {
-	Vec2_<int> dir;
-	if (!bufferedMoves.empty()) {
-		dir = bufferedMoves.front();	// If queue is not empty, read from the queue
-	}
-	else {
-		dir = direction;				// Otherwise read the last used direction
-	}
-
-	return dir;
+	return segments.size();
 }
 
 /**
-    Draws all of the snake's segments and the spacing between them to the board 
+	Returns the grid the snake moves on
 
-    @param board object for the snake to be drawn to
+	@return grid
 */
-void Snake::draw(Board & brd) const {
-	for (int i = (int)segments.size() - 1; i >= 0; --i) {
-		segments[i].draw(brd);
-
-		if (i != 0) {	// If not drawing the head, draw spacing between segments (Head has no "next" segment)
-			const Vec2_<int> nextLoc = segments[i-1].getLocation();
-
-			const Vec2_<int> currentLoc = segments[i].getLocation();
-			const Vec2_<int> currentGridLocation = Board::convertToGridLocation(currentLoc);
-
-			for (int j = 0; j < Board::Tile::SIZE; ++j) {
-				//  next segment is to the right
-				if (nextLoc.x - currentLoc.x == 1)
-					brd.drawLargePixel({ currentGridLocation.x + Board::Tile::SIZE, currentGridLocation.y + j }); // Draw vertical line to the right of the segment
-				//  next segment is to the left
-				else if (nextLoc.x - currentLoc.x == -1)
-					brd.drawLargePixel({ currentGridLocation.x - 1, currentGridLocation.y + j });	// Draw vertical line to the left of the segment
-				//  next segment is below 
-				else if (nextLoc.y - currentLoc.y == 1)
-					brd.drawLargePixel({ currentGridLocation.x + j, currentGridLocation.y + Board::Tile::SIZE });	// Horizontal line underneath
-				//  next segment is above
-				else if (nextLoc.y - currentLoc.y == -1)
-					brd.drawLargePixel({ currentGridLocation.x + j , currentGridLocation.y - 1 });	// Horizontal line above
-			}
-		}
-	}
+template<typename GridType>
+const GridType & BasicSnake<GridType>::getGrid() const
+{
+	return grid;
 }
 
 /**
-    Listens for keyboard input and loads a direction into the queue based on keys pressed
-    Controls: Arrow Keys or WASD
+	Returns the tiles covered by the snake, one bit per tile index (see Grid::toIndex)
 
-    @param e Key press event
+	@return occupancy
 */
+template<typename GridType>
+const Bitboard<GridType::CELL_CAPACITY>& BasicSnake<GridType>::getOccupancy() const
+{
+	return occupancy;
+}
 
-void Snake::handleKeyPressEvent(const Keyboard::Event e)
+/**
+	Returns the Zobrist hash of the snake (see Zobrist.h), updated as the snake moves
+
+	@return hash of the covered tiles, the head and the direction
+*/
+template<typename GridType>
+std::uint64_t BasicSnake<GridType>::getHash() const
 {
-	assert(e.IsPress());
+	return hash;
+}
 
-	Vec2_<int> newDirection;
+/**
+	Computes the Zobrist hash of the snake from scratch, walking the occupancy. getHash is the same value in O(1)
 
-	if (e.GetCode() == (VK_UP) || e.GetCode() == ('W')) {
-		newDirection = {DIR_UP};		
-	}
-	else if (e.GetCode() == (VK_LEFT) || e.GetCode() == ('A')) {
-		newDirection = {DIR_LEFT};
-	}
-	else if (e.GetCode() == (VK_DOWN) || e.GetCode() == ('S')) {
-		newDirection = {DIR_DOWN};
-	}
-	else if (e.GetCode() == (VK_RIGHT) || e.GetCode() == ('D')) {
-		newDirection = {DIR_RIGHT};
-	}
-	else {
-		newDirection = direction;
+	@return hash of the covered tiles, the head and the direction
+*/
+template<typename GridType>
+std::uint64_t BasicSnake<GridType>::computeHash() const
+{
+	std::uint64_t result = Zobrist::getKey(Zobrist::Head, grid.toIndex(getHeadLocation())) ^ Zobrist::getDirectionKey(direction);
+	for (int w = 0; w < occupancy.getWordCount(); ++w) {
+		for (std::uint64_t bits = occupancy.getWord(w); bits != 0; bits &= bits - 1) {
+			result ^= Zobrist::getKey(Zobrist::Cell, w * 64 + Bitboard<GridType::CELL_CAPACITY>::countTrailingZeros(bits));
+		}
 	}
-	
+	return result;
+}
 
-	if (newDirection != -direction) {	// Only use new input if snake isn't trying to walk into itself 
-		direction = newDirection;		// Otherwise use old direction
-	}
+/**
+	States whether or not the next move keeps the tail in place (grow() has been called since the last move)
 
-	if (bufferedMoves.empty() || (direction != -bufferedMoves.back() && direction != bufferedMoves.back())) {	// Make sure two consequent moves aren't in the same or opposite direction of each other
-		bufferedMoves.push_back(direction);																		// i.e. only allow 90 degree turns one after another
-	}
+	@return bool
+*/
+template<typename GridType>
+bool BasicSnake<GridType>::isGrowing() const
+{
+	return pendingGrowth > 0;
 }
 
 /**
-    States whether or not the input location collides with any of the snake's body segments
+	Returns the location of a segment of the snake
+	A PackedBody decodes segments walking from the head, prefer begin() / end() to visit all of them
 
-    @param tileLocation Input location in Tile units
-    @return bool
+	@param index Index of the segment, 0 being the head and getLength() - 1 the tail
+	@return location in Tile units
 */
-bool Snake::isInTile(const Vec2_<int> & tileLocation) const
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getSegmentLocation(int index) const
 {
-	for (int i = 0; i < segments.size(); ++i) {
-		if (tileLocation == segments[i].getLocation())
-			return true;
-	}
-	return false;
+	assert(index >= 0 && index < getLength());
+	return segments[index];
 }
 
 /**
-    Constructs a new Segment at input location
-    
-    @param tileLocation states where the segment is to be located
+	Returns the location of the snake's head
+
+	@return location in Tile units
 */
-Snake::Segment::Segment(const Vec2_<int>& tileLocation)
-	:
-	location(tileLocation)
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getHeadLocation() const
 {
+	return segments.front();
 }
 
 /**
-    Makes current segment follow the segment in front of it (main logic behind how the snake moves)
+	Returns the location of the snake's last segment
 
-    @param nextSegment reference to the next segment of the snake
+	@return location in Tile units
 */
-void Snake::Segment::follow(const Segment & nextSegment)
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getTailLocation() const
 {
-	location = nextSegment.location;
+	return segments.back();
 }
 
 /**
-    Moves the segment
+	Returns an iterator to the head, incrementing it visits the segments down to the tail
 
-    @param direction directional vector stating where the segment is to move to
-    @param brd Board object reference on which the snake moves
+	@return iterator
 */
-void Snake::Segment::move(const Vec2_<int> & direction, Board & brd)
+template<typename GridType>
+typename BasicSnake<GridType>::SegmentIterator BasicSnake<GridType>::begin() const
 {
-	assert(abs(direction.x) + abs(direction.y) == 1);
-	location += direction;
+	return segments.begin();
 }
 
 /**
-    Draws the segment to the board
+	Returns the iterator past the tail
 
-    @param brd Board reference on which the segment is to be drawn
+	@return iterator
 */
-void Snake::Segment::draw(Board & brd) const
+template<typename GridType>
+typename BasicSnake<GridType>::SegmentIterator BasicSnake<GridType>::end() const
 {
-	// A single segment occupies a 1x1 tile space. We need to convert that to 3x3 large pixel space so we can draw each individual large pixel
-	Vec2_<int> gridLocation = Board::convertToGridLocation(location);
+	return segments.end();
+}
 
-    //  Draws the 3x3 large pixel segment
-	for (int i = 0; i < Board::Tile::SIZE; ++i) {
-		for (int j = 0; j <  Board::Tile::SIZE; ++j) {
-			brd.drawLargePixel({gridLocation.x+i, gridLocation.y+j});
-		}
+/**
+	Returns the next direction which is going to be used
+
+	@return direction
+*/
+template<typename GridType>
+Vec2_<int> BasicSnake<GridType>::getNextDirection() const
+{
+	Vec2_<int> dir;
+	if (!bufferedMoves.empty()) {
+		dir = bufferedMoves.front();	// If queue is not empty, read from the queue
+	}
+	else {
+		dir = direction;				// Otherwise read the last used direction
 	}
+
+	return dir;
 }
 
 /**
-    segment location getter
+    Loads a direction into the queue of buffered moves (Keyboard input is mapped to directions by the Game)
 
-    @return location location of segment
+    @param newDirection Requested direction, one of DIR_UP, DIR_DOWN, DIR_LEFT, DIR_RIGHT
 */
-
-const Vec2_<int> Snake::Segment::getLocation() const
+template<typename GridType>
+void BasicSnake<GridType>::queueDirection(Vec2_<int> newDirection)
 {
-	return location;
-}
+	if (bufferedMoves.size() == MaxBufferedMoves) {
+		return;							// Queue is full, the input is dropped
+	}
 
+	if (newDirection != -direction) {	// Only use new input if snake isn't trying to walk into itself 
+		hash ^= Zobrist::getDirectionKey(direction) ^ Zobrist::getDirectionKey(newDirection);
+		direction = newDirection;		// Otherwise use old direction
+	}
+	if (bufferedMoves.empty() || (direction != -bufferedMoves.back() && direction != bufferedMoves.back())) {	// Make sure two consequent moves aren't in the same or opposite direction of each other
+		bufferedMoves.pushBack(direction);																		// i.e. only allow 90 degree turns one after another
+	}
+}
 
+/**
+    States whether or not the input location collides with any of the snake's body segments
 
+    @param tileLocation Input location in Tile units
+    @return bool
+*/
+template<typename GridType>
+bool BasicSnake<GridType>::isInTile(const Vec2_<int> & tileLocation) const
+{
+	return grid.isInside(tileLocation) && occupancy.test(grid.toIndex(tileLocation));
+}
 
+template class BasicSnake<Grid>;
+template class BasicSnake<ClassicGrid>;
+template class BasicSnake<MediumGrid>;
+template class BasicSnake<LargeGrid>;
+template class BasicSnake<HugeGrid>;
@@ -1,50 +1,58 @@
 /**
     Handles the Snake logic
+    Platform independent, drawing is done by Board::drawSnake
+
+    BasicSnake is compiled for the runtime sized Grid (Snake) and for the FixedGrid presets in Grid.h
+    (e.g. BasicSnake<ClassicGrid>), see the explicit instantiations at the bottom of Snake.cpp
+    The body is a PackedBody, or a RingBody of segment locations in builds with SNEK_RING_BUFFER_BODY
 
     @author Benjamin Korady
-    @version 1.1    21/10/2017
+    @version 1.4    17/10/2026
 */
 
 #pragma once
 
-#include "Keyboard.h"
-#include "Board.h"
-#include <chrono>
-
-class Snake {
-private:
-
-	/**
-		Manages each individual segment of the snake
-	*/
-	class Segment {
-	public:
-		Segment(const Vec2_<int>& tileLocation);
-
-		void follow(const Segment& next);
-		void move(const Vec2_<int>& direction, Board & brd);
-
-		const Vec2_<int> getLocation() const;
-		void draw(Board& brd) const;
-
-	private:
-		Vec2_<int> location;	// tile units
-	};
+#include "Grid.h"
+#include "Bitboard.h"
+#include "PackedBody.h"
+#include "RingBody.h"
+#include "RingBuffer.h"
+#include "Vec2.h"
+#include <cstdint>
 
+template<typename GridType>
+class BasicSnake {
 public:
-    Snake();
+#ifdef SNEK_RING_BUFFER_BODY
+	using Body = RingBody<GridType::CELL_CAPACITY>;
+#else
+	using Body = PackedBody<GridType::CELL_CAPACITY>;
+#endif
+	using SegmentIterator = typename Body::Iterator;
+
+    BasicSnake(const GridType& grid = GridType());
     void reset();
-    void move(Board & brd);
+    void move();
     void grow();
 	void setSpeed(int speed);
-	void handleKeyPressEvent(const Keyboard::Event e);	// Snake controls
+	void queueDirection(Vec2_<int> newDirection);	// Snake controls
 
 	bool isInTile(const Vec2_<int>& tileLocation) const;
 	Vec2_<int> getNextHeadLocation() const;
 	Vec2_<int> getDirection() const;
 	int getSpeed() const;
-    void draw(Board& brd) const;
-    bool isTurnToMove(std::chrono::steady_clock::time_point now) const;
+	float getMovePeriod() const;
+	int getLength() const;
+	bool isGrowing() const;
+	Vec2_<int> getSegmentLocation(int index) const;
+	Vec2_<int> getHeadLocation() const;
+	Vec2_<int> getTailLocation() const;
+	SegmentIterator begin() const;	// Segment locations from the head to the tail
+	SegmentIterator end() const;
+	const GridType& getGrid() const;
+	const Bitboard<GridType::CELL_CAPACITY>& getOccupancy() const;
+	std::uint64_t getHash() const;
+	std::uint64_t computeHash() const;
 
 private:
 	Vec2_<int> getNextDirection() const;
@@ -52,19 +60,21 @@ private:
 public:
 	static constexpr int MaxSpeed = 9;
 	static constexpr int MinSpeed = 1;
+	static constexpr int MaxBufferedMoves = 4;	// Turns queued beyond this, before the snake has moved, are ignored
 
 private:
 	static constexpr int nStartingSegments = 9;
-	std::vector<Segment> segments;
-	std::deque<Vec2_<int>> bufferedMoves;	// Stores changes in direction queued up from the keyboard
+	GridType grid;
+	int pendingGrowth = 0;					// Number of upcoming moves which keep the tail instead of dropping it. Next to grid, where it fills the padding
+	Body segments;							// Segment locations in tile units. Moving pushes a new head and drops the tail
+	Bitboard<GridType::CELL_CAPACITY> occupancy;						// Tiles covered by the segments, kept in sync by reset / move so isInTile doesn't have to walk the segments
+	RingBuffer<Vec2_<int>, MaxBufferedMoves> bufferedMoves;	// Stores changes in direction queued up from the keyboard
     Vec2_<int> direction = {DIR_ZERO};		// Current direction
-	Vec2_<int> nextDirection = {DIR_ZERO};	// Direction after reading an input from the keyboard input queue
+	std::uint64_t hash = 0;					// Zobrist hash of the occupancy, head and direction, kept in sync by reset / move / queueDirection
 
     float movePeriod = 0.375f;
 	int speedLevel = 3;						// Proportional to movePeriod. Works as a discontinuous function f(speedLevel) = movePeriod
+};
 
-    std::chrono::steady_clock::time_point lastMoved = std::chrono::steady_clock::now(); 
-	// Stores point in time when snake last moved and uses this to determine if enough time has passed 
-	// for it to move again
-
-};
\ No newline at end of file
+using Snake = BasicSnake<Grid>;
+using ClassicSnake = BasicSnake<ClassicGrid>;	// Snake of the windowed game
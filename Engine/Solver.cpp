@@ -0,0 +1,445 @@
+#include "Solver.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <assert.h>
+
+namespace {
+	const char MAGIC[8] = { 'S', 'N', 'E', 'K', 'S', 'O', 'L', '1' };
+
+	std::uint64_t hashKey(std::uint64_t hi, std::uint64_t lo)
+	{
+		return CounterRng::mix(hi ^ CounterRng::mix(lo));
+	}
+}
+
+/**
+	Constructs the solver and opens its transposition table
+	Throws std::runtime_error if the grid is too big or the table file was made for another grid or capacity
+
+	@param grid Grid the positions are played on, at most MAX_CELLS tiles
+	@param tableCapacity Number of values the table can hold, rounded up to a power of 2. It stops taking new ones at 3/4 full
+	@param tablePath File holding the table across runs, created if it doesn't exist. Empty to keep the table in memory
+*/
+Solver::Solver(const Grid& grid, std::size_t tableCapacity, const std::string& tablePath)
+	:
+	grid(grid),
+	cellCount(grid.getCellCount()),
+	nSymmetries(grid.getWidth() == grid.getHeight() ? 8 : 4),
+	levels(cellCount + 1)
+{
+	if (cellCount > MAX_CELLS) {
+		throw std::runtime_error("Solver only handles grids of up to 36 tiles");
+	}
+	const int width = grid.getWidth();
+	const int height = grid.getHeight();
+
+	// Symmetry s flips x if bit 0 is set and y if bit 1 is, after swapping x and y if bit 2 is (square grids only)
+	symmetricTiles.resize(std::size_t(nSymmetries) * cellCount);
+	for (int s = 0; s < nSymmetries; ++s) {
+		for (int tile = 0; tile < cellCount; ++tile) {
+			Vec2_<int> location = grid.toLocation(tile);
+			if (s & 4) {
+				std::swap(location.x, location.y);
+			}
+			if (s & 1) {
+				location.x = width - 1 - location.x;
+			}
+			if (s & 2) {
+				location.y = height - 1 - location.y;
+			}
+			symmetricTiles[std::size_t(s) * cellCount + tile] = std::uint8_t(grid.toIndex(location));
+		}
+	}
+	const Vec2_<int> dirs[4] = { { 0, -1 }, { 0, 1 }, { -1, 0 }, { 1, 0 } };
+	neighbours.resize(std::size_t(cellCount) * 4);
+	for (int tile = 0; tile < cellCount; ++tile) {
+		for (int d = 0; d < 4; ++d) {
+			const Vec2_<int> next = grid.toLocation(tile) + dirs[d];
+			neighbours[tile * 4 + d] = std::int8_t(grid.isInside(next) ? grid.toIndex(next) : -1);
+		}
+	}
+
+	std::size_t capacity = 1024;
+	while (capacity < tableCapacity) {
+		capacity *= 2;
+	}
+	const std::size_t size = sizeof(Header) + capacity * sizeof(Entry);
+	if (tablePath.empty()) {
+		memory.assign(size / sizeof(std::uint64_t), 0);
+		header = reinterpret_cast<Header*>(memory.data());
+	}
+	else {
+		file.reset(new MappedFile(tablePath, size));
+		header = static_cast<Header*>(file->getData());
+	}
+	entries = reinterpret_cast<Entry*>(header + 1);
+
+	static const char NO_MAGIC[8] = {};
+	if (std::memcmp(header->magic, NO_MAGIC, sizeof(MAGIC)) == 0) {	// New table
+		std::memcpy(header->magic, MAGIC, sizeof(MAGIC));
+		header->width = std::uint32_t(width);
+		header->height = std::uint32_t(height);
+		header->capacity = capacity;
+		header->count = 0;
+	}
+	else if (std::memcmp(header->magic, MAGIC, sizeof(MAGIC)) != 0 || header->width != std::uint32_t(width)
+		|| header->height != std::uint32_t(height) || header->capacity != capacity) {
+		throw std::runtime_error("Table " + tablePath + " was made for another grid or capacity");
+	}
+}
+
+/**
+	Solves a game's current position
+
+	@param sim Game on the solver's grid
+	@return best expected number of food the snake can still eat, 0 if the game is over
+*/
+double Solver::solve(const Simulation& sim)
+{
+	if (sim.isGameOver()) {
+		return 0.0;
+	}
+	const std::vector<Vec2_<int>> segments(sim.getSnake().begin(), sim.getSnake().end());
+	return getValue(makeBody(segments), grid.toIndex(sim.getFood().getLocation()));
+}
+
+/**
+	Solves a position
+
+	@param segments Locations of the snake's segments from the head to the tail, each next to the one before
+	@param food Location of the food, not under the snake
+	@return best expected number of food the snake can still eat
+*/
+double Solver::solve(const std::vector<Vec2_<int>>& segments, Vec2_<int> food)
+{
+	const Body body = makeBody(segments);
+	assert(grid.isInside(food) && !(body.occupancy >> grid.toIndex(food) & 1));
+	return getValue(body, grid.toIndex(food));
+}
+
+/**
+	Returns the first move of a best plan: the start of a shortest path to the body eating the food which solves best
+	Always moving along a shortest path makes sure the snake gets there, rather than circling between equal positions
+
+	@param sim Game on the solver's grid
+	@return action to play, Action::None if the game is over
+*/
+SimulationBase::Action Solver::getBestAction(const Simulation& sim)
+{
+	if (sim.isGameOver()) {
+		return SimulationBase::Action::None;
+	}
+	const std::vector<Vec2_<int>> segments(sim.getSnake().begin(), sim.getSnake().end());
+	const Body body = makeBody(segments);
+	const int food = grid.toIndex(sim.getFood().getLocation());
+	int node;
+	search(body, food, node);
+	const std::vector<Node>& nodes = levels[body.length].nodes;
+
+	int next = -1;
+	if (node < 0) {		// Food can't be reached, any move which doesn't die will do
+		for (int d = 0; d < 4 && next < 0; ++d) {
+			const int tile = neighbours[body.tiles[0] * 4 + d];
+			if (tile >= 0 && !(body.occupancy >> tile & 1)) {
+				next = tile;
+			}
+		}
+		if (next < 0) {
+			return SimulationBase::Action::None;
+		}
+	}
+	else if (node == 0) {
+		next = food;
+	}
+	else {
+		while (nodes[node].parent != 0) {
+			node = nodes[node].parent;
+		}
+		next = nodes[node].body.tiles[0];
+	}
+	return SimulationBase::toAction(grid.toLocation(next) - grid.toLocation(body.tiles[0]));
+}
+
+/**
+	Returns what the solver did since it was constructed
+
+	@return stats
+*/
+const Solver::Stats& Solver::getStats() const
+{
+	return stats;
+}
+
+/**
+	Returns the number of values in the table, including those stored by earlier runs on the same file
+
+	@return number of entries in use
+*/
+std::uint64_t Solver::getTableCount() const
+{
+	return header->count;
+}
+
+/**
+	Returns the number of values the table has room for
+
+	@return number of entries
+*/
+std::size_t Solver::getTableCapacity() const
+{
+	return std::size_t(header->capacity);
+}
+
+Solver::Body Solver::makeBody(const std::vector<Vec2_<int>>& segments) const
+{
+	assert(!segments.empty() && int(segments.size()) <= cellCount);
+	Body body = {};
+	body.length = int(segments.size());
+	for (int i = 0; i < body.length; ++i) {
+		assert(grid.isInside(segments[i]));
+		assert(i == 0 || abs(segments[i].x - segments[i - 1].x) + abs(segments[i].y - segments[i - 1].y) == 1);
+		body.tiles[i] = std::uint8_t(grid.toIndex(segments[i]));
+		body.occupancy |= std::uint64_t(1) << body.tiles[i];
+	}
+	return body;
+}
+
+/**
+	Returns the value of a position, from the table if it was solved before
+
+	@param body Snake
+	@param food Tile of the food
+	@return best expected number of food eaten
+*/
+double Solver::getValue(const Body& body, int food)
+{
+	const Key key = getKey(body, food);
+	double value;
+	if (lookup(key, value)) {
+		return value;
+	}
+	int node;
+	value = search(body, food, node);
+	store(key, value);
+	return value;
+}
+
+/**
+	Returns the value of a snake which has just eaten: the mean value over the tiles the next food can land on
+
+	@param body Snake
+	@return expected number of food eaten from then on, 0 if the snake fills the board
+*/
+double Solver::getGrownValue(const Body& body)
+{
+	if (body.length == cellCount) {
+		return 0.0;
+	}
+	const Key key = getKey(body, NO_FOOD);
+	double value;
+	if (lookup(key, value)) {
+		return value;
+	}
+	double total = 0.0;
+	for (int tile = 0; tile < cellCount; ++tile) {
+		if (!(body.occupancy >> tile & 1)) {
+			total += getValue(body, tile);
+		}
+	}
+	value = total / (cellCount - body.length);
+	store(key, value);
+	return value;
+}
+
+/**
+	Visits every body the snake can move into without eating, breadth first, and solves the ones that eat the food next
+	Stops early once one of them eats every food left, nothing can do better
+
+	@param start Snake
+	@param food Tile of the food
+	@param bestNode Receives the index in levels[start.length].nodes of the body eating best, -1 if none can eat
+	@return value of the position
+*/
+double Solver::search(const Body& start, int food, int& bestNode)
+{
+	++stats.positions;
+	Level& level = levels[start.length];
+	level.nodes.clear();
+	level.visited.clear();
+	level.nodes.push_back({ start, -1 });
+	level.visited.insert(getRawKey(start));
+
+	const double bound = double(cellCount - start.length);
+	double best = 0.0;
+	bestNode = -1;
+	for (int i = 0; i < int(level.nodes.size()) && best < bound; ++i) {
+		++stats.bodies;
+		const Body body = level.nodes[i].body;	// Copied, pushing nodes can move them
+		for (int d = 0; d < 4; ++d) {
+			const int tile = neighbours[body.tiles[0] * 4 + d];
+			if (tile < 0 || (body.occupancy >> tile & 1)) {
+				continue;	// Wall or body, the tail included since it only moves after the head
+			}
+			Body next;
+			next.tiles[0] = std::uint8_t(tile);
+			if (tile == food) {
+				next.length = body.length + 1;
+				next.occupancy = body.occupancy | std::uint64_t(1) << tile;
+				std::copy(body.tiles, body.tiles + body.length, next.tiles + 1);
+				const double value = 1.0 + getGrownValue(next);
+				if (value > best) {
+					best = value;
+					bestNode = i;
+				}
+				continue;
+			}
+			next.length = body.length;
+			next.occupancy = (body.occupancy & ~(std::uint64_t(1) << body.tiles[body.length - 1])) | std::uint64_t(1) << tile;
+			std::copy(body.tiles, body.tiles + body.length - 1, next.tiles + 1);
+			if (level.visited.insert(getRawKey(next))) {
+				level.nodes.push_back({ next, i });
+			}
+		}
+	}
+	return best;
+}
+
+/**
+	Returns the key of a position shared by all of its symmetric positions: the smallest of their keys
+	Fields of the high word: the last 3 links, head tile (bit 8), food tile (bit 14), length (bit 20) and bit 63 set.
+	The low word holds the first 32 links, 2 bits each in PackedBody's format
+
+	@param body Snake
+	@param food Tile of the food, or NO_FOOD
+	@return key
+*/
+Solver::Key Solver::getKey(const Body& body, int food) const
+{
+	const int width = grid.getWidth();
+	Key best = { ~std::uint64_t(0), ~std::uint64_t(0) };
+	for (int s = 0; s < nSymmetries; ++s) {
+		const std::uint8_t* map = &symmetricTiles[std::size_t(s) * cellCount];
+		Key key = { std::uint64_t(1) << 63, 0 };
+		key.hi |= std::uint64_t(map[body.tiles[0]]) << 8;
+		key.hi |= std::uint64_t(food == NO_FOOD ? NO_FOOD : map[food]) << 14;
+		key.hi |= std::uint64_t(body.length) << 20;
+		for (int i = 0; i + 1 < body.length; ++i) {
+			const int step = int(map[body.tiles[i]]) - int(map[body.tiles[i + 1]]);
+			const std::uint64_t code = step == 1 ? 0 : step == width ? 1 : step == -1 ? 2 : 3;
+			if (i < 32) {
+				key.lo |= code << (i * 2);
+			}
+			else {
+				key.hi |= code << ((i - 32) * 2);
+			}
+		}
+		if (key.hi < best.hi || (key.hi == best.hi && key.lo < best.lo)) {
+			best = key;
+		}
+	}
+	return best;
+}
+
+/**
+	Returns the key of a body as it is, without the food, to tell the bodies of one search apart
+
+	@param body Snake
+	@return key
+*/
+Solver::Key Solver::getRawKey(const Body& body) const
+{
+	const int width = grid.getWidth();
+	Key key = { std::uint64_t(1) << 63 | std::uint64_t(body.tiles[0]) << 8, 0 };
+	for (int i = 0; i + 1 < body.length; ++i) {
+		const int step = int(body.tiles[i]) - int(body.tiles[i + 1]);
+		const std::uint64_t code = step == 1 ? 0 : step == width ? 1 : step == -1 ? 2 : 3;
+		if (i < 32) {
+			key.lo |= code << (i * 2);
+		}
+		else {
+			key.hi |= code << ((i - 32) * 2);
+		}
+	}
+	return key;
+}
+
+bool Solver::lookup(const Key& key, double& value)
+{
+	const std::uint64_t mask = header->capacity - 1;
+	for (std::uint64_t slot = hashKey(key.hi, key.lo) & mask; entries[slot].hi != 0; slot = (slot + 1) & mask) {
+		if (entries[slot].hi == key.hi && entries[slot].lo == key.lo) {
+			value = entries[slot].value;
+			++stats.hits;
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+	Adds a value to the table, unless it is 3/4 full
+	The high word is written last, so a run stopped halfway through leaves the entry empty rather than wrong
+*/
+void Solver::store(const Key& key, double value)
+{
+	const std::uint64_t capacity = header->capacity;
+	if (header->count >= capacity - capacity / 4) {
+		return;
+	}
+	std::uint64_t slot = hashKey(key.hi, key.lo) & (capacity - 1);
+	while (entries[slot].hi != 0) {
+		if (entries[slot].hi == key.hi && entries[slot].lo == key.lo) {
+			return;
+		}
+		slot = (slot + 1) & (capacity - 1);
+	}
+	entries[slot].lo = key.lo;
+	entries[slot].value = value;
+	entries[slot].hi = key.hi;
+	++header->count;
+	++stats.stores;
+}
+
+void Solver::KeySet::clear()
+{
+	count = 0;
+	if (++stamp == 0) {		// Wrapped around, old stamps could match again
+		std::fill(stamps.begin(), stamps.end(), 0);
+		stamp = 1;
+	}
+}
+
+bool Solver::KeySet::insert(const Key& key)
+{
+	if ((count + 1) * 2 > keys.size()) {	// Keeps at least half of the slots free
+		std::vector<Key> oldKeys;
+		for (std::size_t slot = 0; slot < keys.size(); ++slot) {
+			if (stamps[slot] == stamp) {
+				oldKeys.push_back(keys[slot]);
+			}
+		}
+		const std::size_t size = std::max<std::size_t>(1024, keys.size() * 2);
+		keys.assign(size, Key());
+		stamps.assign(size, 0);
+		stamp = 1;
+		count = 0;
+		for (const Key& oldKey : oldKeys) {
+			insert(oldKey);
+		}
+	}
+	const std::size_t mask = keys.size() - 1;
+	std::size_t slot = std::size_t(hashKey(key.hi, key.lo)) & mask;
+	while (stamps[slot] == stamp) {
+		if (keys[slot].hi == key.hi && keys[slot].lo == key.lo) {
+			return false;
+		}
+		slot = (slot + 1) & mask;
+	}
+	keys[slot] = key;
+	stamps[slot] = stamp;
+	++count;
+	return true;
+}
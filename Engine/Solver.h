@@ -0,0 +1,129 @@
+/**
+	Exhaustive solver for tiny boards (at most MAX_CELLS tiles): the best expected number of food a snake can still eat
+	from a position, with every new food placed uniformly on a free tile as BasicFood does. Gives the ground truth
+	the heuristic bots can be measured against
+
+	Ticks don't count, only the order in which the snake's bodies follow each other, so the value of a position is the best,
+	over the bodies in which the snake can eat the food, of 1 plus the mean value over the next food's tiles.
+	The bodies come from a search over the bodies of the same length (they only change by moving); eating
+	makes the snake longer, so the recursion ends when the snake fills the board
+
+	Values are kept in a transposition table keyed by the body and food, turned into the smallest key among
+	the symmetries of the grid (flips, plus rotations for square grids) since they all have the same value.
+	The table can live in a file mapped into memory, so runs on the same grid start from what earlier ones solved
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "Simulation.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class Solver {
+public:
+	struct Stats {
+		std::uint64_t positions = 0;	// Positions (body and food) searched
+		std::uint64_t bodies = 0;		// Bodies visited by those searches
+		std::uint64_t hits = 0;			// Values found in the table
+		std::uint64_t stores = 0;		// Values added to the table
+	};
+
+public:
+	Solver(const Grid& grid, std::size_t tableCapacity = std::size_t(1) << 20, const std::string& tablePath = "");
+	Solver(const Solver&) = delete;
+	Solver& operator=(const Solver&) = delete;
+
+	double solve(const Simulation& sim);
+	double solve(const std::vector<Vec2_<int>>& segments, Vec2_<int> food);
+	SimulationBase::Action getBestAction(const Simulation& sim);
+
+	const Stats& getStats() const;
+	std::uint64_t getTableCount() const;
+	std::size_t getTableCapacity() const;
+
+public:
+	static constexpr int MAX_CELLS = 36;	// Tile indices fit in 6 bits and the links of a body in 2 words
+
+private:
+	struct Body {
+		std::uint64_t occupancy;
+		int length;
+		std::uint8_t tiles[MAX_CELLS];	// Tile indices from the head to the tail
+	};
+
+	struct Key {
+		std::uint64_t hi;	// Never 0, so 0 marks an empty table entry
+		std::uint64_t lo;
+	};
+
+	struct Node {
+		Body body;
+		int parent;			// Node the body was reached from, -1 for the first one
+	};
+
+	/**
+		Set of keys cleared in constant time: a slot only counts when it carries the current stamp
+	*/
+	struct KeySet {
+		std::vector<Key> keys;
+		std::vector<std::uint32_t> stamps;
+		std::uint32_t stamp = 0;
+		std::size_t count = 0;
+
+		void clear();
+		bool insert(const Key& key);	// false if the key was already in
+	};
+
+	/**
+		Search buffers of one snake length. Searches only recurse into longer snakes, so each length has at most one
+		search running and reuses its buffers from one search to the next
+	*/
+	struct Level {
+		std::vector<Node> nodes;
+		KeySet visited;
+	};
+
+	struct Entry {
+		std::uint64_t hi;
+		std::uint64_t lo;
+		double value;
+	};
+
+	struct Header {
+		char magic[8];
+		std::uint32_t width;
+		std::uint32_t height;
+		std::uint64_t capacity;		// Entries following the header, a power of 2
+		std::uint64_t count;		// Entries in use
+	};
+
+private:
+	Body makeBody(const std::vector<Vec2_<int>>& segments) const;
+	double getValue(const Body& body, int food);
+	double getGrownValue(const Body& body);
+	double search(const Body& start, int food, int& bestNode);
+	Key getKey(const Body& body, int food) const;
+	Key getRawKey(const Body& body) const;
+	bool lookup(const Key& key, double& value);
+	void store(const Key& key, double value);
+
+private:
+	static constexpr int NO_FOOD = 63;		// Food field of the keys of getGrownValue's entries
+	Grid grid;
+	int cellCount;
+	int nSymmetries;						// 8 on square grids, 4 otherwise
+	std::vector<std::uint8_t> symmetricTiles;	// Tile each tile maps to, nSymmetries rows of cellCount
+	std::vector<std::int8_t> neighbours;	// Up to 4 tiles next to each tile, -1 past the grid's edge
+	std::vector<Level> levels;				// Indexed by snake length
+	std::unique_ptr<MappedFile> file;
+	std::vector<std::uint64_t> memory;		// Header and table when there is no file
+	Header* header;
+	Entry* entries;
+	Stats stats;
+};
@@ -0,0 +1,38 @@
+/**
+	Selects the container behind the simulation's fixed-capacity collections (Bitboard, PackedBody, RingBuffer):
+	std::array when the capacity is known at compile time (FixedGrid), otherwise a std::vector
+	which is sized once, on construction (Grid)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include <array>
+#include <vector>
+#include <assert.h>
+
+static constexpr int DYNAMIC_CAPACITY = 0;	// Capacity only known at runtime
+
+template<typename T, int CAPACITY>
+struct Storage {
+	using Type = std::array<T, CAPACITY>;
+
+	static Type make(int size)
+	{
+		assert(size == CAPACITY);
+		(void)size;
+		return Type();
+	}
+};
+
+template<typename T>
+struct Storage<T, DYNAMIC_CAPACITY> {
+	using Type = std::vector<T>;
+
+	static Type make(int size)
+	{
+		return Type(size);
+	}
+};
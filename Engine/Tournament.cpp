@@ -0,0 +1,283 @@
+#include "Tournament.h"
+#include "CounterRng.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <assert.h>
+
+namespace {
+	/**
+		Episode numbers [begin, end) a thread still has to play, packed into one word (begin in the high half)
+		so both the owner taking the next episode and a thief taking half of the range are a single compare-and-swap
+		Aligned to a cache line, so the threads' ranges don't share one
+	*/
+	struct alignas(64) EpisodeRange {
+		std::atomic<std::uint64_t> range{ 0 };
+
+		static std::uint64_t pack(std::uint32_t begin, std::uint32_t end)
+		{
+			return (std::uint64_t(begin) << 32) | end;
+		}
+
+		bool take(std::uint32_t& episode)	// Called by the owner, takes the first episode
+		{
+			std::uint64_t current = range.load(std::memory_order_relaxed);
+			for (;;) {
+				const std::uint32_t begin = std::uint32_t(current >> 32);
+				const std::uint32_t end = std::uint32_t(current);
+				if (begin >= end) {
+					return false;
+				}
+				if (range.compare_exchange_weak(current, pack(begin + 1, end), std::memory_order_relaxed)) {
+					episode = begin;
+					return true;
+				}
+			}
+		}
+
+		bool steal(std::uint32_t& stolenBegin, std::uint32_t& stolenEnd)	// Called by other threads, takes the upper half (at least one episode)
+		{
+			std::uint64_t current = range.load(std::memory_order_relaxed);
+			for (;;) {
+				const std::uint32_t begin = std::uint32_t(current >> 32);
+				const std::uint32_t end = std::uint32_t(current);
+				if (begin >= end) {
+					return false;
+				}
+				const std::uint32_t middle = begin + (end - begin) / 2;
+				if (range.compare_exchange_weak(current, pack(begin, middle), std::memory_order_relaxed)) {
+					stolenBegin = middle;
+					stolenEnd = end;
+					return true;
+				}
+			}
+		}
+	};
+
+	static_assert(sizeof(EpisodeRange) == 64, "A range fills one cache line");
+	static_assert(std::is_trivially_destructible<EpisodeRange>::value, "Ranges are never destroyed");
+
+	/**
+		The threads' ranges, starting on a cache line boundary: before C++17, std::vector and new don't honour
+		alignments beyond the fundamental one, so the storage is allocated one range larger and aligned by hand
+	*/
+	class EpisodeRanges {
+	public:
+		explicit EpisodeRanges(int count)
+			:
+			storage(new unsigned char[(count + 1) * sizeof(EpisodeRange)])
+		{
+			void* start = storage.get();
+			std::size_t space = (count + 1) * sizeof(EpisodeRange);
+			ranges = static_cast<EpisodeRange*>(std::align(alignof(EpisodeRange), count * sizeof(EpisodeRange), start, space));
+			assert(ranges != nullptr);
+			for (int i = 0; i < count; ++i) {
+				new (ranges + i) EpisodeRange();
+			}
+		}
+
+		EpisodeRange& operator[](int index)
+		{
+			return ranges[index];
+		}
+
+	private:
+		std::unique_ptr<unsigned char[]> storage;
+		EpisodeRange* ranges;
+	};
+
+	/**
+		Adds to an atomic maximum
+	*/
+	void updateMax(std::atomic<int>& maximum, int value)
+	{
+		int current = maximum.load(std::memory_order_relaxed);
+		while (value > current && !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+		}
+	}
+}
+
+template<typename GridType>
+constexpr std::uint64_t BasicTournament<GridType>::MAX_EPISODES;
+
+/**
+	Constructs the tournament
+
+	@param grid Grid the games are played on
+*/
+template<typename GridType>
+BasicTournament<GridType>::BasicTournament(const GridType& grid)
+	:
+	grid(grid)
+{
+}
+
+/**
+	Plays the episodes and returns the merged results
+	Throws std::runtime_error if there are more than MAX_EPISODES episodes
+
+	@param makeBot Creates the bot of one thread
+	@param settings Number of episodes / threads, seed, speed level and tick limit
+	@return results of all episodes
+*/
+template<typename GridType>
+typename BasicTournament<GridType>::Results BasicTournament<GridType>::run(const BotFactory& makeBot, const Settings& settings) const
+{
+	if (settings.episodes > MAX_EPISODES) {
+		throw std::runtime_error("Too many episodes: " + std::to_string(settings.episodes) + " (at most " + std::to_string(MAX_EPISODES) + ")");
+	}
+	const std::uint32_t nEpisodes = std::uint32_t(settings.episodes);
+	int nThreads = settings.threads > 0 ? settings.threads : int(std::thread::hardware_concurrency());
+	nThreads = std::max(1, std::min<int>(nThreads, std::max<std::uint32_t>(nEpisodes, 1)));
+
+	// Equal shares to start with, the scheduler evens out the rest
+	EpisodeRanges ranges(nThreads);
+	for (int t = 0; t < nThreads; ++t) {
+		const std::uint32_t begin = std::uint32_t(std::uint64_t(nEpisodes) * t / nThreads);
+		const std::uint32_t end = std::uint32_t(std::uint64_t(nEpisodes) * (t + 1) / nThreads);
+		ranges[t].range.store(EpisodeRange::pack(begin, end), std::memory_order_relaxed);
+	}
+
+	const int foodCapacity = grid.getCellCount() + 1;
+	std::atomic<std::uint64_t> ticks{ 0 };
+	std::atomic<std::uint64_t> wins{ 0 };
+	std::atomic<std::uint64_t> timeouts{ 0 };
+	std::atomic<std::uint64_t> steals{ 0 };
+	std::atomic<std::int64_t> totalScore{ 0 };
+	std::atomic<int> topScore{ 0 };
+	std::vector<std::atomic<std::uint64_t>> foodHistogram(foodCapacity);
+	for (auto& count : foodHistogram) {
+		count.store(0, std::memory_order_relaxed);
+	}
+
+	const CounterRng seeds(settings.seed);
+	const auto work = [&](int self) {
+		BasicSimulation<GridType> sim(grid);
+		sim.getSnake().setSpeed(settings.speedLevel);
+		const int scorePerFood = sim.getSnake().getSpeed();
+		std::unique_ptr<BasicBot<GridType>> bot = makeBot();
+
+		// Counted locally, added to the shared totals once at the end
+		std::uint64_t localTicks = 0;
+		std::uint64_t localWins = 0;
+		std::uint64_t localTimeouts = 0;
+		std::uint64_t localSteals = 0;
+		std::int64_t localScore = 0;
+		int localTop = 0;
+		std::vector<std::uint64_t> localHistogram(foodCapacity, 0);
+
+		const auto play = [&](std::uint32_t episode) {
+			sim.reset(seeds(episode));
+			bot->reset(sim);
+			while (!sim.isGameOver() && sim.getTick() < settings.maxTicks) {
+				sim.step(bot->act(sim));
+			}
+			localTicks += sim.getTick();
+			localWins += sim.isWon();
+			localTimeouts += !sim.isGameOver();
+			localScore += sim.getScore();
+			localTop = std::max(localTop, sim.getScore());
+			++localHistogram[std::min(sim.getScore() / scorePerFood, foodCapacity - 1)];
+		};
+
+		std::uint32_t episode;
+		for (;;) {
+			while (ranges[self].take(episode)) {
+				play(episode);
+			}
+			bool stole = false;
+			for (int i = 1; i < nThreads && !stole; ++i) {
+				std::uint32_t begin, end;
+				if (ranges[(self + i) % nThreads].steal(begin, end)) {
+					ranges[self].range.store(EpisodeRange::pack(begin, end), std::memory_order_relaxed);
+					stole = true;
+					++localSteals;
+				}
+			}
+			if (!stole) {
+				break;	// Every range is empty, what is left is being played by the other threads
+			}
+		}
+
+		ticks.fetch_add(localTicks, std::memory_order_relaxed);
+		wins.fetch_add(localWins, std::memory_order_relaxed);
+		timeouts.fetch_add(localTimeouts, std::memory_order_relaxed);
+		steals.fetch_add(localSteals, std::memory_order_relaxed);
+		totalScore.fetch_add(localScore, std::memory_order_relaxed);
+		updateMax(topScore, localTop);
+		for (int f = 0; f < foodCapacity; ++f) {
+			if (localHistogram[f] != 0) {
+				foodHistogram[f].fetch_add(localHistogram[f], std::memory_order_relaxed);
+			}
+		}
+	};
+
+	const auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> threads;
+	for (int t = 1; t < nThreads; ++t) {
+		threads.emplace_back(work, t);
+	}
+	work(0);
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	Results results;
+	results.episodes = nEpisodes;
+	results.ticks = ticks.load();
+	results.wins = wins.load();
+	results.timeouts = timeouts.load();
+	results.steals = steals.load();
+	results.totalScore = totalScore.load();
+	results.topScore = topScore.load();
+	results.foodHistogram.resize(foodCapacity);
+	for (int f = 0; f < foodCapacity; ++f) {
+		results.foodHistogram[f] = foodHistogram[f].load();
+	}
+	results.threads = nThreads;
+	results.seconds = elapsed.count();
+	return results;
+}
+
+/**
+	Returns the mean score of the episodes
+
+	@return mean score, 0 if no episode was played
+*/
+template<typename GridType>
+double BasicTournament<GridType>::Results::getMeanScore() const
+{
+	return episodes > 0 ? double(totalScore) / episodes : 0.0;
+}
+
+/**
+	Returns the number of food eaten which the given fraction of the episodes didn't exceed
+
+	@param fraction Between 0 and 1, e.g. 0.5 for the median
+	@return number of food eaten
+*/
+template<typename GridType>
+int BasicTournament<GridType>::Results::getFoodPercentile(double fraction) const
+{
+	std::uint64_t count = 0;
+	for (int f = 0; f < int(foodHistogram.size()); ++f) {
+		count += foodHistogram[f];
+		if (count > 0 && double(count) >= fraction * episodes) {
+			return f;
+		}
+	}
+	return 0;
+}
+
+template class BasicTournament<Grid>;
+template class BasicTournament<ClassicGrid>;
+template class BasicTournament<MediumGrid>;
+template class BasicTournament<LargeGrid>;
+template class BasicTournament<HugeGrid>;
@@ -0,0 +1,61 @@
+/**
+	Plays a large number of games (episodes) with a bot on all cores and collects their scores
+	Episodes are handed out by a work-stealing scheduler: every thread starts with an equal range of episode numbers
+	and, once it runs out, steals half of the remaining range of another thread, so threads which drew long games
+	(a good bot can play for hundreds of thousands of ticks) don't leave the others idle
+	Every thread counts its results locally and adds them to the shared totals once, with atomic adds
+
+	Episode i is played with the seed CounterRng(seed)(i), so the results don't depend on the number of threads
+
+	@author Benjamin Korady
+	@version 1.1	17/10/2026
+*/
+
+#pragma once
+
+#include "Bot.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+template<typename GridType>
+class BasicTournament {
+public:
+	using BotFactory = std::function<std::unique_ptr<BasicBot<GridType>>()>;	// Called once per thread
+
+	static constexpr std::uint64_t MAX_EPISODES = 0xFFFFFFFF;	// Episode numbers of a thread's range are packed in 32 bits
+
+	struct Settings {
+		std::uint64_t episodes = 1000;			// At most MAX_EPISODES, run throws otherwise
+		int threads = 0;						// 0 uses every hardware thread
+		std::uint64_t seed = 1;
+		int speedLevel = 3;
+		std::uint64_t maxTicks = 10000000;		// Episodes still running after this many ticks are stopped (a bot going round in circles)
+	};
+
+	struct Results {
+		std::uint64_t episodes = 0;
+		std::uint64_t ticks = 0;
+		std::uint64_t wins = 0;
+		std::uint64_t timeouts = 0;
+		std::uint64_t steals = 0;				// Ranges a thread took from another one once out of work
+		std::int64_t totalScore = 0;
+		int topScore = 0;
+		std::vector<std::uint64_t> foodHistogram;	// Number of episodes by the number of food eaten (score / speed level)
+		int threads = 0;
+		double seconds = 0.0;
+
+		double getMeanScore() const;
+		int getFoodPercentile(double fraction) const;
+	};
+
+public:
+	BasicTournament(const GridType& grid = GridType());
+	Results run(const BotFactory& makeBot, const Settings& settings) const;
+
+private:
+	GridType grid;
+};
+
+using Tournament = BasicTournament<ClassicGrid>;
@@ -0,0 +1,132 @@
+#include "TrajectoryExporter.h"
+#include "VectorEnv.h"
+#include <algorithm>
+
+/**
+	Opens the columns' files
+	Throws std::runtime_error if a file can't be opened, or doesn't hold its column when appending
+
+	@param prefix Start of the files' paths, e.g. "data/bfs_"
+	@param grid Grid the games are played on
+	@param chunkRows Rows gathered per column before they are written
+	@param appends true to add rows to an existing dataset, false to replace it. Columns left longer than the others
+	(the export was stopped while writing them) are cut to the shortest one
+*/
+template<typename GridType>
+BasicTrajectoryExporter<GridType>::BasicTrajectoryExporter(const std::string& prefix, const GridType& grid, std::size_t chunkRows, bool appends)
+	:
+	bodyRow((grid.getCellCount() + 63) / 64, 0),
+	body(prefix + "body.npy", "<u8", { std::uint64_t(bodyRow.size()) }, chunkRows, appends),
+	head(prefix + "head.npy", "<i4", {}, chunkRows, appends),
+	food(prefix + "food.npy", "<i4", {}, chunkRows, appends),
+	direction(prefix + "direction.npy", "<i4", {}, chunkRows, appends),
+	length(prefix + "length.npy", "<i4", {}, chunkRows, appends),
+	action(prefix + "action.npy", "|u1", {}, chunkRows, appends),
+	reward(prefix + "reward.npy", "<f4", {}, chunkRows, appends),
+	done(prefix + "done.npy", "|u1", {}, chunkRows, appends),
+	episode(prefix + "episode.npy", "<u8", {}, chunkRows, appends),
+	tick(prefix + "tick.npy", "<u8", {}, chunkRows, appends),
+	columns{ &body, &head, &food, &direction, &length, &action, &reward, &done, &episode, &tick }
+{
+	std::uint64_t rows = body.getRowCount();
+	for (NpyWriter* column : columns) {
+		rows = std::min(rows, column->getRowCount());
+	}
+	for (NpyWriter* column : columns) {
+		if (column->getRowCount() > rows) {
+			column->truncate(rows);
+		}
+	}
+}
+
+/**
+	Exports the game's state and the action, then plays the step
+
+	@param sim Game, stepped once
+	@param actionIn Action played
+	@param episodeIn Number of the game for the episode column
+	@param isLastStep true if the caller stops the game after this step, it is then Truncated unless it ends by itself
+	@return what happened during the step
+*/
+template<typename GridType>
+SimulationBase::Outcome BasicTrajectoryExporter<GridType>::step(BasicSimulation<GridType>& sim, SimulationBase::Action actionIn, std::uint64_t episodeIn, bool isLastStep)
+{
+	const GridType& grid = sim.getGrid();
+	const BasicSnake<GridType>& snek = sim.getSnake();
+	const auto& occupancy = snek.getOccupancy();
+	for (int w = 0; w < occupancy.getWordCount(); ++w) {
+		bodyRow[w] = occupancy.getWord(w);
+	}
+	const std::int32_t headIndex = grid.toIndex(snek.getHeadLocation());
+	const std::int32_t foodIndex = grid.toIndex(sim.getFood().getLocation());
+	const std::int32_t directionCode = std::int32_t(SimulationBase::toAction(snek.getDirection()));
+	const std::int32_t segments = snek.getLength();
+	const std::uint8_t actionCode = std::uint8_t(actionIn);
+	const std::uint64_t tickIn = sim.getTick();
+
+	const SimulationBase::Outcome outcome = sim.step(actionIn);
+	float rewardValue = 0.0f;
+	if (outcome == SimulationBase::Outcome::Ate || outcome == SimulationBase::Outcome::Won) {
+		rewardValue = BasicVectorEnv<GridType>::REWARD_FOOD;
+	}
+	else if (outcome == SimulationBase::Outcome::Died) {
+		rewardValue = BasicVectorEnv<GridType>::REWARD_DEATH;
+	}
+	using Done = typename BasicVectorEnv<GridType>::Done;
+	const std::uint8_t doneCode = sim.isGameOver() ? Done::Terminated : isLastStep ? Done::Truncated : Done::Running;
+
+	body.append(bodyRow.data());
+	head.append(&headIndex);
+	food.append(&foodIndex);
+	direction.append(&directionCode);
+	length.append(&segments);
+	action.append(&actionCode);
+	reward.append(&rewardValue);
+	done.append(&doneCode);
+	episode.append(&episodeIn);
+	tick.append(&tickIn);
+	return outcome;
+}
+
+/**
+	Writes every column's gathered rows, the files then hold every row exported so far
+	Throws std::runtime_error if a file can't be written
+*/
+template<typename GridType>
+void BasicTrajectoryExporter<GridType>::flush()
+{
+	for (NpyWriter* column : columns) {
+		column->flush();
+	}
+}
+
+/**
+	Returns the number of rows exported
+
+	@return count
+*/
+template<typename GridType>
+std::uint64_t BasicTrajectoryExporter<GridType>::getRowCount() const
+{
+	return tick.getRowCount();
+}
+
+/**
+	Returns the most memory the gathered rows take, over every column
+
+	@return bytes
+*/
+template<typename GridType>
+std::size_t BasicTrajectoryExporter<GridType>::getChunkSize() const
+{
+	std::size_t size = 0;
+	for (const NpyWriter* column : columns) {
+		size += column->getChunkSize();
+	}
+	return size;
+}
+
+template class BasicTrajectoryExporter<ClassicGrid>;
+template class BasicTrajectoryExporter<MediumGrid>;
+template class BasicTrajectoryExporter<LargeGrid>;
+template class BasicTrajectoryExporter<HugeGrid>;
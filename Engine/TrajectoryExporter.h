@@ -0,0 +1,56 @@
+/**
+	Exports (state, action, reward) trajectories of played games for offline training: each step taken through it
+	adds a row to every column, each column being its own .npy file (see NpyWriter) named prefix + column + ".npy".
+	Columns are written in chunks, so memory stays the same however many rows are exported, and an existing
+	dataset can be appended to
+	The state is the one the action was taken in, in the same fields as VectorEnv's observations; the reward and
+	done flag are VectorEnv's for the step:
+		body		<u8 (rows, words)	One bit per tile index covered by the snake
+		head		<i4					Tile index of the head
+		food		<i4					Tile index of the food
+		direction	<i4					Action matching the snake's direction, Action::None before the first move
+		length		<i4					Number of segments
+		action		|u1					Action played
+		reward		<f4					REWARD_FOOD for eating, REWARD_DEATH for dying, 0 otherwise
+		done		|u1					Running, Terminated or Truncated
+		episode		<u8					Number given by the caller, e.g. the game's seed or counter
+		tick		<u8					Steps the game had taken
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "NpyWriter.h"
+#include "Simulation.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+template<typename GridType>
+class BasicTrajectoryExporter {
+public:
+	BasicTrajectoryExporter(const std::string& prefix, const GridType& grid = GridType(), std::size_t chunkRows = 1 << 16, bool appends = false);
+
+	SimulationBase::Outcome step(BasicSimulation<GridType>& sim, SimulationBase::Action action, std::uint64_t episode, bool isLastStep = false);
+	void flush();
+	std::uint64_t getRowCount() const;
+	std::size_t getChunkSize() const;
+
+private:
+	std::vector<std::uint64_t> bodyRow;
+	NpyWriter body;
+	NpyWriter head;
+	NpyWriter food;
+	NpyWriter direction;
+	NpyWriter length;
+	NpyWriter action;
+	NpyWriter reward;
+	NpyWriter done;
+	NpyWriter episode;
+	NpyWriter tick;
+	NpyWriter* columns[10];					// Every column above, in order
+};
+
+using TrajectoryExporter = BasicTrajectoryExporter<ClassicGrid>;
@@ -12,7 +12,7 @@ class Vec2_
 {
 public:
 	Vec2_() = default;
-	Vec2_( T x_in,T y_in )
+	constexpr Vec2_( T x_in,T y_in )
 		:
 		x( x_in ),
 		y( y_in )
@@ -53,7 +53,7 @@ public:
 	bool operator==(const Vec2_& rhs) {
 		return rhs.x == x && rhs.y == y;
 	}
-	bool operator!=(const Vec2_& rhs) {
+	bool operator!=(const Vec2_& rhs) const {
 		return !(*this == rhs);
 	}
 	friend bool operator==(const Vec2_& lhs, const Vec2_& rhs) {
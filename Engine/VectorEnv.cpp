@@ -0,0 +1,129 @@
+#include "VectorEnv.h"
+#include <algorithm>
+#include <assert.h>
+
+template<typename GridType>
+constexpr float BasicVectorEnv<GridType>::REWARD_FOOD;
+template<typename GridType>
+constexpr float BasicVectorEnv<GridType>::REWARD_DEATH;
+
+/**
+	Constructs the environments, call reset before the first step
+
+	@param nEnvs Number of environments stepped together
+	@param speedLevel Speed level of the snakes (only changes the score, rewards are per food)
+	@param maxEpisodeTicks Episodes are truncated after this many steps
+	@param grid Grid the games are played on
+*/
+template<typename GridType>
+BasicVectorEnv<GridType>::BasicVectorEnv(int nEnvs, int speedLevel, std::uint64_t maxEpisodeTicks, const GridType& grid)
+	:
+	batch(nEnvs, speedLevel, grid),
+	maxEpisodeTicks(maxEpisodeTicks),
+	seedStreams(nEnvs),
+	episodes(nEnvs)
+{
+	assert(maxEpisodeTicks > 0);
+}
+
+/**
+	Starts a new episode in every environment
+
+	@param seeds One seed per environment, used by its first episode. Automatic resets derive their seeds from it
+	@param observations Receives one observation per environment
+*/
+template<typename GridType>
+void BasicVectorEnv<GridType>::reset(const std::uint64_t* seeds, Observation* observations)
+{
+	for (int env = 0; env < getEnvCount(); ++env) {
+		batch.reset(env, seeds[env]);
+		seedStreams[env] = CounterRng(seeds[env]);
+		episodes[env] = 0;
+		observe(env, observations[env]);
+	}
+}
+
+/**
+	Advances every environment by one step. Environments whose episode ends are reset right away,
+	their observation is then the first one of the new episode, while the reward and done flag belong to the step taken
+
+	@param actions One action per environment
+	@param observations Receives one observation per environment
+	@param rewards Receives one reward per environment: REWARD_FOOD for eating, REWARD_DEATH for dying, 0 otherwise
+	@param dones Receives one Done value per environment
+*/
+template<typename GridType>
+void BasicVectorEnv<GridType>::step(const Action* actions, Observation* observations, float* rewards, std::uint8_t* dones)
+{
+	batch.step(actions);
+	for (int env = 0; env < getEnvCount(); ++env) {
+		const SimulationBase::Outcome outcome = batch.getOutcome(env);
+		float reward = 0.0f;
+		std::uint8_t done = Running;
+		if (outcome == SimulationBase::Outcome::Ate || outcome == SimulationBase::Outcome::Won) {
+			reward = REWARD_FOOD;
+		}
+		else if (outcome == SimulationBase::Outcome::Died) {
+			reward = REWARD_DEATH;
+		}
+		if (batch.isGameOver(env)) {
+			done = Terminated;
+		}
+		else if (batch.getTick(env) >= maxEpisodeTicks) {
+			done = Truncated;
+		}
+		if (done != Running) {
+			batch.reset(env, seedStreams[env](episodes[env]++));
+		}
+		rewards[env] = reward;
+		dones[env] = done;
+		observe(env, observations[env]);
+	}
+}
+
+/**
+	Returns the number of environments
+
+	@return number of environments
+*/
+template<typename GridType>
+int BasicVectorEnv<GridType>::getEnvCount() const
+{
+	return batch.getGameCount();
+}
+
+/**
+	Returns the games behind the environments, e.g. to look at scores
+
+	@return batch simulation
+*/
+template<typename GridType>
+const BasicBatchSimulation<GridType>& BasicVectorEnv<GridType>::getBatch() const
+{
+	return batch;
+}
+
+/**
+	Writes the observation of one environment
+
+	@param env Index of the environment
+	@param observation Receives the observation
+*/
+template<typename GridType>
+void BasicVectorEnv<GridType>::observe(int env, Observation& observation) const
+{
+	const GridType& grid = batch.getGrid();
+	const Bitboard<GridType::CELL_CAPACITY>& occupancy = batch.getOccupancy(env);
+	for (int w = 0; w < occupancy.getWordCount(); ++w) {
+		observation.body[w] = occupancy.getWord(w);
+	}
+	observation.head = grid.toIndex(batch.getHeadLocation(env));
+	observation.food = grid.toIndex(batch.getFoodLocation(env));
+	observation.direction = std::int32_t(SimulationBase::toAction(batch.getDirection(env)));
+	observation.length = batch.getLength(env);
+}
+
+template class BasicVectorEnv<ClassicGrid>;
+template class BasicVectorEnv<MediumGrid>;
+template class BasicVectorEnv<LargeGrid>;
+template class BasicVectorEnv<HugeGrid>;
@@ -0,0 +1,62 @@
+/**
+	Reinforcement learning environment over the snake rules, gym style: reset(seeds) / step(actions) on a batch
+	of environments at once, backed by the batch simulation
+	Observations, rewards and done flags are written into buffers owned by the caller (one entry per environment,
+	contiguous), nothing is allocated after construction. Finished episodes are reset automatically
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "BatchSimulation.h"
+#include <cstdint>
+#include <vector>
+
+template<typename GridType>
+class BasicVectorEnv {
+public:
+	using Action = SimulationBase::Action;
+
+	/**
+		What an agent sees of one environment, plain data so a buffer of them can be handed to other languages as is
+	*/
+	struct Observation {
+		std::uint64_t body[(GridType::CELL_CAPACITY + 63) / 64];	// One bit per tile index (see Grid::toIndex) covered by the snake
+		std::int32_t head;			// Tile index of the head
+		std::int32_t food;			// Tile index of the food
+		std::int32_t direction;		// Action matching the snake's direction, Action::None before the first move
+		std::int32_t length;		// Number of segments
+	};
+
+	enum Done : std::uint8_t {
+		Running,
+		Terminated,		// Snake died or filled the board
+		Truncated		// Episode reached maxEpisodeTicks
+	};
+
+public:
+	BasicVectorEnv(int nEnvs, int speedLevel = 3, std::uint64_t maxEpisodeTicks = 100000, const GridType& grid = GridType());
+
+	void reset(const std::uint64_t* seeds, Observation* observations);
+	void step(const Action* actions, Observation* observations, float* rewards, std::uint8_t* dones);
+
+	int getEnvCount() const;
+	const BasicBatchSimulation<GridType>& getBatch() const;
+
+public:
+	static constexpr float REWARD_FOOD = 1.0f;
+	static constexpr float REWARD_DEATH = -1.0f;
+
+private:
+	void observe(int env, Observation& observation) const;
+
+private:
+	BasicBatchSimulation<GridType> batch;
+	std::uint64_t maxEpisodeTicks;
+	std::vector<CounterRng> seedStreams;		// Seeds of the following episodes of each environment, keyed by the seed given to reset
+	std::vector<std::uint64_t> episodes;		// Number of episodes each environment has finished since reset
+};
+
+using VectorEnv = BasicVectorEnv<ClassicGrid>;
@@ -0,0 +1,43 @@
+/**
+	Keys of the Zobrist hash of a game: the hash is the XOR of the keys of the tiles covered by the snake,
+	of the head's tile, of the snake's direction and of the food's tile, so a move or a respawn updates it
+	with a few XORs instead of going over the whole board
+	Keys are hashes of (feature, index) with the counter-based generator, nothing is stored, so every grid size
+	and every copy of a game shares them
+
+	Building with SNEK_CHECK_HASH (CMake option of the same name) compares the hash with a full recompute
+	after every step and reset, and throws std::runtime_error when they differ
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#pragma once
+
+#include "CounterRng.h"
+#include "Vec2.h"
+#include <cstdint>
+
+namespace Zobrist {
+	constexpr std::uint64_t SEED = 0x5EED2B0B157ull;
+
+	enum Feature {
+		Cell,		// Tile covered by the snake
+		Head,		// Tile of the head
+		Food,		// Tile of the food
+		Direction	// Index is the direction's code, see getDirectionKey
+	};
+
+	inline std::uint64_t getKey(Feature feature, int index)
+	{
+		return CounterRng(SEED)(std::uint64_t(index) * 4 + feature);
+	}
+
+	inline std::uint64_t getDirectionKey(Vec2_<int> dir)	// 0 for DIR_ZERO, the snake hasn't moved yet
+	{
+		if (dir.x == 0 && dir.y == 0) {
+			return 0;
+		}
+		return getKey(Direction, dir.x != 0 ? 1 - dir.x : 2 - dir.y);	// Same codes as PackedBody::encode
+	}
+}
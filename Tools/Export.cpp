@@ -0,0 +1,81 @@
+/**
+	Plays games with a bot and exports every step as a row of a columnar trajectory dataset (see TrajectoryExporter)
+
+	Usage: snek_export <prefix> [episodes] [bot] [seed] [chunk rows] [append]
+	bot is one of: safe, bfs, hamilton (bfs by default); append adds to an existing dataset instead of replacing it.
+	Game i is played with the seed CounterRng(seed)(i), which is its number in the episode column: appending with
+	another seed adds other games
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "TrajectoryExporter.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) {
+		std::cerr << "usage: snek_export <prefix> [episodes] [bot] [seed] [chunk rows] [append]\n";
+		return 1;
+	}
+	const std::string prefix = argv[1];
+	const std::uint64_t episodes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1000;
+	const std::string botName = argc > 3 ? argv[3] : "bfs";
+	const std::uint64_t seed = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1;
+	const std::size_t chunkRows = argc > 5 ? std::size_t(std::strtoull(argv[5], nullptr, 10)) : std::size_t(1) << 16;
+	const bool appends = argc > 6 && std::string(argv[6]) == "append";
+	static constexpr std::uint64_t MAX_TICKS = 100000;	// Episodes still running after this many ticks are truncated
+
+	std::unique_ptr<Bot> bot;
+	if (botName == "safe") {
+		bot.reset(new RandomBot(seed, true));
+	}
+	else if (botName == "bfs") {
+		bot.reset(new BfsBot());
+	}
+	else if (botName == "hamilton") {
+		bot.reset(new HamiltonianBot());
+	}
+	else {
+		std::cerr << "unknown bot: " << botName << "\n";
+		return 1;
+	}
+
+	try {
+		const auto start = std::chrono::steady_clock::now();
+		TrajectoryExporter exporter(prefix, ClassicGrid(), chunkRows > 0 ? chunkRows : 1, appends);
+		const std::uint64_t firstRow = exporter.getRowCount();
+		GameState sim;
+		const CounterRng seeds(seed);
+		for (std::uint64_t game = 0; game < episodes; ++game) {
+			const std::uint64_t episode = seeds(game);
+			sim.reset(episode);
+			bot->reset(sim);
+			while (!sim.isGameOver() && sim.getTick() < MAX_TICKS) {
+				exporter.step(sim, bot->act(sim), episode, sim.getTick() + 1 == MAX_TICKS);
+			}
+		}
+		exporter.flush();
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		const std::uint64_t rows = exporter.getRowCount() - firstRow;
+		std::cout << "episodes:  " << episodes << "\n"
+			<< "rows:      " << rows << " (" << exporter.getRowCount() << " in the dataset)\n"
+			<< "buffers:   " << exporter.getChunkSize() / 1024 << " KiB\n"
+			<< "seconds:   " << elapsed.count() << "\n"
+			<< "rows/s:    " << (elapsed.count() > 0.0 ? rows / elapsed.count() : 0.0) << "\n";
+	}
+	catch (const std::runtime_error& e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+	return 0;
+}
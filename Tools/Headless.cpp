@@ -0,0 +1,79 @@
+/**
+	Runs the game rules without a window at unlimited speed.
+	Plays a number of games with a random policy and reports the simulation throughput
+	The seed picks both the policy's moves and the food placement, so runs with the same arguments give the same scores
+
+	Usage: snek_headless [games] [seed] [level] [width] [height]
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Simulation.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+int main(int argc, char* argv[])
+{
+	const int games = argc > 1 ? std::atoi(argv[1]) : 100000;
+	const unsigned int seed = argc > 2 ? (unsigned int)std::strtoul(argv[2], nullptr, 10) : 1u;
+	const int level = argc > 3 ? std::atoi(argv[3]) : 3;
+	const int width = argc > 4 ? std::atoi(argv[4]) : Grid::CLASSIC_WIDTH;
+	const int height = argc > 5 ? std::atoi(argv[5]) : Grid::CLASSIC_HEIGHT;
+	if (width < 2 || height < 1) {
+		std::cerr << "the grid has to be at least 2x1 tiles\n";
+		return 1;
+	}
+
+	static constexpr Simulation::Action ACTIONS[] = {
+		Simulation::Action::Up, Simulation::Action::Down, Simulation::Action::Left, Simulation::Action::Right
+	};
+
+	std::mt19937 policyRng(seed);
+	std::uniform_int_distribution<int> turnDist(0, 7);		// Turns on 1 in 8 ticks on average
+	std::uniform_int_distribution<int> actionDist(0, 3);
+
+	// The snake starts in the bottom row with its head on the right: it opens upwards, or along the row on a grid one tile high
+	const Simulation::Action opening = height > 1 ? Simulation::Action::Up : Simulation::Action::Right;
+
+	Simulation sim(Grid(width, height));
+	sim.getSnake().setSpeed(level);
+	if (sim.getSnake().getLength() >= width * height) {
+		std::cerr << "the snake fills a " << width << "x" << height << " grid from the start\n";
+		return 1;
+	}
+
+	std::uint64_t totalTicks = 0;
+	std::int64_t totalScore = 0;
+	int topScore = 0;
+	int wins = 0;
+
+	const auto start = std::chrono::steady_clock::now();
+	for (int game = 0; game < games; ++game) {
+		sim.reset(CounterRng(seed)(game));	// Independent food stream for every game
+		sim.step(opening);
+		while (!sim.isGameOver()) {
+			const Simulation::Action action = turnDist(policyRng) == 0 ? ACTIONS[actionDist(policyRng)] : Simulation::Action::None;
+			sim.step(action);
+		}
+		totalTicks += sim.getTick();
+		totalScore += sim.getScore();
+		wins += sim.isWon();
+		if (sim.getScore() > topScore) {
+			topScore = sim.getScore();
+		}
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::cout << "games:        " << games << "\n"
+		<< "ticks:        " << totalTicks << "\n"
+		<< "mean score:   " << (games > 0 ? (double)totalScore / games : 0.0) << "\n"
+		<< "top score:    " << topScore << "\n"
+		<< "wins:         " << wins << "\n"
+		<< "seconds:      " << elapsed.count() << "\n"
+		<< "ticks/second: " << (elapsed.count() > 0.0 ? totalTicks / elapsed.count() : 0.0) << "\n";
+	return 0;
+}
@@ -0,0 +1,166 @@
+/**
+	Records games played by a bot into a replay file, or replays every game of a file at unlimited speed
+	and checks that each one ends with its recorded tick and score, or packs a replay file into an entropy coded
+	stream (see ReplayCodec), which play reads too. record packs the games as they are played if asked to
+
+	Usage: snek_replay record <file> [games] [seed] [bot] [packed]
+	       snek_replay play <file>
+	       snek_replay pack <file> <packed file>
+	bot is one of: safe, bfs, hamilton (bfs by default). Like a player, the bot only presses a key to turn
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "ReplayRecorder.h"
+#include "ReplayCodec.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+static int record(const std::string& path, int games, std::uint64_t seed, const std::string& botName, bool packs)
+{
+	std::unique_ptr<Bot> bot;
+	if (botName == "safe") {
+		bot.reset(new RandomBot(seed, true));
+	}
+	else if (botName == "bfs") {
+		bot.reset(new BfsBot());
+	}
+	else if (botName == "hamilton") {
+		bot.reset(new HamiltonianBot());
+	}
+	else {
+		std::cerr << "unknown bot: " << botName << "\n";
+		return 1;
+	}
+
+	static constexpr std::uint64_t MAX_TICKS = 1000000;
+	ReplayRecorder recorder(path, false, packs ? ReplayRecorder::Format::Packed : ReplayRecorder::Format::Plain);
+	if (!recorder.isOpen()) {
+		std::cerr << "Can't open " << path << "\n";
+		return 1;
+	}
+	GameState sim;
+	const CounterRng seeds(seed);
+	std::uint64_t events = 0;
+	std::uint64_t ticks = 0;
+	for (int game = 0; game < games; ++game) {
+		sim.reset(seeds(game));
+		bot->reset(sim);
+		recorder.beginGame(sim);
+		while (!sim.isGameOver() && sim.getTick() < MAX_TICKS) {
+			const SimulationBase::Action action = bot->act(sim);
+			if (action != SimulationBase::Action::None && SimulationBase::toDirection(action) != sim.getSnake().getDirection()) {
+				recorder.recordAction(sim.getTick(), action);
+				sim.queueAction(action);
+				++events;
+			}
+			sim.step();
+		}
+		recorder.endGame(sim.getTick(), sim.getScore());
+		ticks += sim.getTick();
+	}
+	std::cout << "games:   " << games << "\n"
+		<< "ticks:   " << ticks << "\n"
+		<< "actions: " << events << "\n";
+	return 0;
+}
+
+static std::vector<std::uint8_t> readFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file) {
+		throw std::runtime_error("Can't open " + path);
+	}
+	return std::vector<std::uint8_t>((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+static int pack(const std::string& path, const std::string& packedPath)
+{
+	const std::vector<std::uint8_t> bytes = readFile(path);
+	std::vector<std::uint8_t> packed;
+	ReplayEncoder encoder(packed);
+	const std::vector<Replay> replays = Replay::decode(bytes.data(), bytes.size());
+	for (const Replay& replay : replays) {
+		encoder.writeGame(replay);
+	}
+	encoder.finish();
+	std::ofstream file(packedPath, std::ios::binary | std::ios::trunc);
+	file.write(reinterpret_cast<const char*>(packed.data()), std::streamsize(packed.size()));
+	if (!file) {
+		throw std::runtime_error("Can't write " + packedPath);
+	}
+	std::cout << "games:  " << replays.size() << "\n"
+		<< "bytes:  " << bytes.size() << " -> " << packed.size() << "\n"
+		<< "ratio:  " << (packed.empty() ? 0.0 : double(bytes.size()) / packed.size()) << "\n";
+	return 0;
+}
+
+static int play(const std::string& path)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::size_t damagedStreams = 0;
+	const std::vector<Replay> replays = ReplayDecoder::load(path, &damagedStreams);
+	std::unique_ptr<Simulation> sim;
+	std::uint64_t ticks = 0;
+	int complete = 0;
+	int mismatches = 0;
+	for (const Replay& replay : replays) {
+		if (!sim || sim->getGrid().getWidth() != replay.header.width || sim->getGrid().getHeight() != replay.header.height) {
+			sim.reset(new Simulation(Grid(replay.header.width, replay.header.height)));
+		}
+		replay.play(*sim);
+		ticks += sim->getTick();
+		if (replay.isComplete) {
+			++complete;
+			if (!replay.matches(*sim)) {
+				++mismatches;
+				std::cerr << "game " << &replay - replays.data() << ": recorded score " << replay.finalScore << " at tick "
+					<< replay.finalTick << ", replayed " << sim->getScore() << " at tick " << sim->getTick() << "\n";
+			}
+		}
+	}
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	if (damagedStreams > 0) {
+		std::cerr << path << ": " << damagedStreams << " stream(s) cut short, their games are played up to the cut\n";
+	}
+	std::cout << "games:      " << replays.size() << " (" << complete << " complete)\n"
+		<< "mismatches: " << mismatches << "\n"
+		<< "ticks:      " << ticks << "\n"
+		<< "seconds:    " << elapsed.count() << "\n"
+		<< "ticks/s:    " << (elapsed.count() > 0.0 ? ticks / elapsed.count() : 0.0) << "\n";
+	return mismatches == 0 && damagedStreams == 0 ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+	const std::string mode = argc > 1 ? argv[1] : "";
+	if (argc < 3 || (mode != "record" && mode != "play" && mode != "pack") || (mode == "pack" && argc < 4)) {
+		std::cerr << "usage: snek_replay record <file> [games] [seed] [bot] [packed]\n       snek_replay play <file>\n"
+			"       snek_replay pack <file> <packed file>\n";
+		return 1;
+	}
+	try {
+		if (mode == "record") {
+			return record(argv[2], argc > 3 ? std::atoi(argv[3]) : 1000, argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1,
+				argc > 5 ? argv[5] : "bfs", argc > 6 && std::string(argv[6]) == "packed");
+		}
+		if (mode == "pack") {
+			return pack(argv[2], argv[3]);
+		}
+		return play(argv[2]);
+	}
+	catch (const std::runtime_error& e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+}
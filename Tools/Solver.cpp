@@ -0,0 +1,95 @@
+/**
+	Solves the starting position of a tiny board exactly and compares the result with the bots
+
+	Usage: snek_solver [width] [height] [table] [episodes]
+	table is a file keeping the solved positions from one run to the next (none by default)
+	Prints the best expected number of food with uniformly placed food, then the mean number of food eaten over
+	the episodes by the solver's own moves (which should match it) and by the heuristic bots
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Solver.h"
+#include "Tournament.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	const int width = argc > 1 ? std::atoi(argv[1]) : 4;
+	const int height = argc > 2 ? std::atoi(argv[2]) : 4;
+	const std::string tablePath = argc > 3 ? argv[3] : "";
+	const std::uint64_t episodes = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : 1000;
+	const Grid grid(width, height);
+	if (grid.getCellCount() > Solver::MAX_CELLS) {
+		std::cerr << "the solver handles grids of up to " << Solver::MAX_CELLS << " tiles\n";
+		return 1;
+	}
+
+	std::unique_ptr<Solver> table;
+	try {
+		table.reset(new Solver(grid, std::size_t(1) << 24, tablePath));
+	}
+	catch (const std::runtime_error& e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+	Solver& solver = *table;
+	const std::uint64_t storedBefore = solver.getTableCount();
+	const auto start = std::chrono::steady_clock::now();
+	const double expectedFood = solver.solve(Simulation(grid));
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const Solver::Stats stats = solver.getStats();
+	std::cout << "grid:           " << width << "x" << height << "\n"
+		<< "expected food:  " << expectedFood << " of " << grid.getCellCount() - std::min(9, width) << "\n"
+		<< "seconds:        " << elapsed.count() << "\n"
+		<< "positions:      " << stats.positions << "\n"
+		<< "bodies:         " << stats.bodies << "\n"
+		<< "bodies/s:       " << (elapsed.count() > 0.0 ? stats.bodies / elapsed.count() : 0.0) << "\n"
+		<< "table hits:     " << stats.hits << "\n"
+		<< "table entries:  " << solver.getTableCount() << " (" << storedBefore << " from earlier runs)\n";
+
+	// Solver's own play, its mean should be close to the expectation
+	Simulation sim(grid);
+	sim.getSnake().setSpeed(1);
+	std::uint64_t solverFood = 0;
+	for (std::uint64_t episode = 0; episode < episodes; ++episode) {
+		sim.reset(episode);
+		while (!sim.isGameOver()) {
+			sim.step(solver.getBestAction(sim));
+		}
+		solverFood += sim.getScore();
+	}
+	std::cout << "solver:         " << double(solverFood) / std::max<std::uint64_t>(episodes, 1) << " food per game\n";
+
+	BasicTournament<Grid>::Settings settings;
+	settings.episodes = episodes;
+	settings.speedLevel = 1;	// Score is the number of food
+	settings.maxTicks = 100000;
+	const BasicTournament<Grid> tournament(grid);
+	const auto report = [&](const std::string& name, const BasicTournament<Grid>::BotFactory& makeBot) {
+		const BasicTournament<Grid>::Results results = tournament.run(makeBot, settings);
+		std::cout << name << std::string(16 - name.size(), ' ') << results.getMeanScore() << " food per game ("
+			<< 100.0 * results.getMeanScore() / expectedFood << "% of the best)\n";
+	};
+	report("safe:", [&settings]() {
+		return std::unique_ptr<BasicBot<Grid>>(new BasicRandomBot<Grid>(settings.seed, true));
+	});
+	report("bfs:", [&grid]() {
+		return std::unique_ptr<BasicBot<Grid>>(new BasicBfsBot<Grid>(grid));
+	});
+	if (grid.getCellCount() % 2 == 0) {		// Otherwise there is no Hamiltonian cycle
+		report("hamilton:", [&grid]() {
+			return std::unique_ptr<BasicBot<Grid>>(new BasicHamiltonianBot<Grid>(grid));
+		});
+	}
+	return 0;
+}
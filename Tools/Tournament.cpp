@@ -0,0 +1,95 @@
+/**
+	Plays a number of games with a bot on all cores and prints the score distribution
+
+	Usage: snek_tournament [episodes] [threads] [seed] [bot] [level]
+	bot is one of: random, safe (random turns, avoiding collisions when it can), bfs (shortest path to the food),
+	hamilton (Hamiltonian cycle with shortcuts), mcts (tree search, 300 playouts per move),
+	heuristic (weighted food distance / free area / tail reachability, see snek_tuner)
+	threads 0 uses every hardware thread, episodes can be at most Tournament::MAX_EPISODES (2^32 - 1)
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "Tournament.h"
+#include "RandomBot.h"
+#include "BfsBot.h"
+#include "HamiltonianBot.h"
+#include "MctsBot.h"
+#include "HeuristicBot.h"
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	Tournament::Settings settings;
+	settings.episodes = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+	settings.threads = argc > 2 ? std::atoi(argv[2]) : 0;
+	settings.seed = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 1;
+	const std::string botName = argc > 4 ? argv[4] : "safe";
+	settings.speedLevel = argc > 5 ? std::atoi(argv[5]) : 3;
+
+	Tournament::BotFactory makeBot;
+	if (botName == "random" || botName == "safe") {
+		const bool avoidsCollisions = botName == "safe";
+		makeBot = [&settings, avoidsCollisions]() {
+			return std::unique_ptr<Bot>(new RandomBot(settings.seed, avoidsCollisions));
+		};
+	}
+	else if (botName == "bfs") {
+		makeBot = []() {
+			return std::unique_ptr<Bot>(new BfsBot());
+		};
+	}
+	else if (botName == "hamilton") {
+		makeBot = []() {
+			return std::unique_ptr<Bot>(new HamiltonianBot());
+		};
+	}
+	else if (botName == "mcts") {
+		makeBot = [&settings]() {
+			MctsBot::Settings search;
+			search.threads = 1;				// The tournament already uses every core
+			search.timeBudget = MctsBot::MAX_TIME_BUDGET;
+			search.maxIterations = 300;		// Fixed amount of search, so results don't depend on the machine
+			search.seed = settings.seed;
+			return std::unique_ptr<Bot>(new MctsBot(search));
+		};
+	}
+	else if (botName == "heuristic") {
+		settings.maxTicks = 100000;		// Some games go round in circles forever, see HeuristicBot
+		makeBot = []() {
+			return std::unique_ptr<Bot>(new HeuristicBot());
+		};
+	}
+	else {
+		std::cerr << "unknown bot: " << botName << "\n";
+		return 1;
+	}
+
+	Tournament::Results results;
+	try {
+		results = Tournament().run(makeBot, settings);
+	}
+	catch (const std::runtime_error& e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+
+	std::cout << "bot:            " << botName << "\n"
+		<< "episodes:       " << results.episodes << "\n"
+		<< "threads:        " << results.threads << "\n"
+		<< "ticks:          " << results.ticks << "\n"
+		<< "mean score:     " << results.getMeanScore() << "\n"
+		<< "top score:      " << results.topScore << "\n"
+		<< "food p10/50/90: " << results.getFoodPercentile(0.1) << " / " << results.getFoodPercentile(0.5)
+		<< " / " << results.getFoodPercentile(0.9) << "\n"
+		<< "wins:           " << results.wins << "\n"
+		<< "timeouts:       " << results.timeouts << "\n"
+		<< "seconds:        " << results.seconds << "\n"
+		<< "episodes/s:     " << (results.seconds > 0.0 ? results.episodes / results.seconds : 0.0) << "\n"
+		<< "ticks/s:        " << (results.seconds > 0.0 ? results.ticks / results.seconds : 0.0) << "\n";
+	return 0;
+}
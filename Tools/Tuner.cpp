@@ -0,0 +1,54 @@
+/**
+	Evolves the weights of the heuristic bot on the classic grid and logs every candidate to a CSV file
+
+	Usage: snek_tuner [generations] [population] [games] [log] [threads] [seed]
+	games is the number of games each candidate plays per generation, log the CSV file (tuner.csv by default)
+	threads 0 uses every hardware thread
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "GeneticTuner.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+	GeneticTuner::Settings settings;
+	settings.generations = argc > 1 ? std::atoi(argv[1]) : 20;
+	settings.population = argc > 2 ? std::atoi(argv[2]) : 200;
+	settings.games = argc > 3 ? std::atoi(argv[3]) : 1000;
+	const std::string logPath = argc > 4 ? argv[4] : "tuner.csv";
+	settings.threads = argc > 5 ? std::atoi(argv[5]) : 0;
+	settings.seed = argc > 6 ? std::strtoull(argv[6], nullptr, 10) : 1;
+	settings.elites = std::min(settings.elites, settings.population);
+
+	std::ofstream log(logPath);
+	if (!log) {
+		std::cerr << "can't write " << logPath << "\n";
+		return 1;
+	}
+	GeneticTuner::writeCsvHeader(log);
+
+	std::printf("%4s %10s %10s %10s %10s %10s %12s %14s\n",
+		"gen", "best food", "mean food", "distance", "area", "tail", "games/s", "ticks/s");
+	int threads = 0;
+	const GeneticTuner::Weights best = GeneticTuner().run(settings, [&log, &threads](const GeneticTuner::Generation& generation) {
+		GeneticTuner::writeCsv(log, generation);
+		threads = generation.threads;
+		const GeneticTuner::Weights& weights = generation.candidates[generation.best];
+		const double meanFood = std::accumulate(generation.meanFood.begin(), generation.meanFood.end(), 0.0) / generation.meanFood.size();
+		const double seconds = generation.seconds > 0.0 ? generation.seconds : 1.0;
+		std::printf("%4d %10.2f %10.2f %10.3f %10.3f %10.3f %12.0f %14.0f\n", generation.index, generation.meanFood[generation.best],
+			meanFood, weights.foodDistance, weights.freeArea, weights.tailReachable, generation.games / seconds, generation.ticks / seconds);
+		std::fflush(stdout);
+	});
+	std::printf("best weights: distance %g, area %g, tail %g (%d threads)\n", best.foodDistance, best.freeArea, best.tailReachable, threads);
+	return 0;
+}
@@ -0,0 +1,124 @@
+/**
+	Checks the claimed scores of every game in replay files (either format) by playing them again on every core,
+	and reports the verdicts and the throughput (reading the files included). Files are mapped into memory;
+	encoded streams are decoded and checked a batch of games at a time. Damaged data is refused and the rest is still
+	checked: in Replay's format the damaged game is malformed and reading goes on from the next game; an encoded stream
+	cut short (the session recording it was killed) is read up to the cut, which ends its last game as incomplete,
+	is reported, and reading goes on from the next stream. A file which can't be read is reported and skipped
+
+	Usage: snek_validator [-t threads] <file>...
+	Exits with 1 if a replay is refused, a file can't be read or a stream is cut short
+
+	@author Benjamin Korady
+	@version 1.0	17/10/2026
+*/
+
+#include "ReplayValidator.h"
+#include "ReplayCodec.h"
+#include "MappedFile.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char* argv[])
+{
+	static constexpr int MAX_LISTED = 20;				// Refused replays listed one by one
+	static constexpr std::size_t BATCH_SIZE = 1 << 16;	// Games of an encoded stream checked at once
+	ReplayValidator::Settings settings;
+	std::vector<std::string> paths;
+	for (int i = 1; i < argc; ++i) {
+		if (std::string(argv[i]) == "-t" && i + 1 < argc) {
+			settings.threads = std::atoi(argv[++i]);
+		}
+		else {
+			paths.push_back(argv[i]);
+		}
+	}
+	if (paths.empty()) {
+		std::cerr << "usage: snek_validator [-t threads] <file>...\n";
+		return 1;
+	}
+
+	try {
+		const ReplayValidator validator(settings);
+		std::uint64_t counts[ReplayValidator::VERDICTS] = {};
+		std::uint64_t replays = 0;
+		std::uint64_t ticks = 0;
+		double seconds = 0.0;
+		int nThreads = 0;
+		int listed = 0;
+		const auto add = [&](const std::string& path, std::uint64_t first, const ReplayValidator::Report& report) {
+			for (std::size_t i = 0; i < report.verdicts.size(); ++i) {
+				const ReplayValidator::Verdict verdict = report.verdicts[i];
+				++counts[int(verdict)];
+				if (verdict != ReplayValidator::Verdict::Accepted && listed++ < MAX_LISTED) {
+					std::cerr << path << ", game " << first + i << ": " << ReplayValidator::getName(verdict) << "\n";
+				}
+			}
+			replays += report.verdicts.size();
+			ticks += report.ticks;
+			seconds += report.seconds;
+			nThreads = report.threads;
+		};
+
+		int unreadable = 0;
+		int damaged = 0;		// Files with encoded streams cut short
+		for (const std::string& path : paths) {
+			std::unique_ptr<MappedFile> file;
+			try {
+				file.reset(new MappedFile(path));
+			}
+			catch (const std::runtime_error& e) {
+				std::cerr << path << ": " << e.what() << "\n";
+				++unreadable;
+				continue;
+			}
+			const std::uint8_t* const data = static_cast<const std::uint8_t*>(file->getData());
+			if (!ReplayDecoder::isEncoded(data, file->getSize())) {
+				add(path, 0, validator.validate(data, file->getSize()));
+				continue;
+			}
+			ReplayDecoder decoder(data, file->getSize());	// Decoded in batches, the stream can't be split between threads
+			std::vector<Replay> batch(BATCH_SIZE);
+			std::uint64_t first = 0;
+			for (bool hasMore = true; hasMore; ) {
+				const auto start = std::chrono::steady_clock::now();
+				std::size_t count = 0;
+				while (count < BATCH_SIZE && (hasMore = decoder.readGame(batch[count]))) {
+					++count;
+				}
+				batch.resize(count);
+				ReplayValidator::Report report = validator.validate(batch);
+				const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+				report.seconds = elapsed.count();
+				add(path, first, report);
+				first += report.verdicts.size();
+				batch.resize(BATCH_SIZE);
+			}
+			if (decoder.getDamagedStreamCount() > 0) {
+				std::cerr << path << ": " << decoder.getDamagedStreamCount() << " stream(s) cut short, their games are read up to the cut\n";
+				++damaged;
+			}
+		}
+
+		std::cout << "replays:    " << replays << "\n";
+		for (int v = 0; v < ReplayValidator::VERDICTS; ++v) {
+			if (counts[v] > 0) {
+				std::cout << "  " << ReplayValidator::getName(ReplayValidator::Verdict(v)) << ": " << counts[v] << "\n";
+			}
+		}
+		std::cout << "threads:    " << nThreads << "\n"
+			<< "seconds:    " << seconds << "\n"
+			<< "replays/s:  " << (seconds > 0.0 ? replays / seconds : 0.0) << "\n"
+			<< "ticks/s:    " << (seconds > 0.0 ? ticks / seconds : 0.0) << "\n";
+		return unreadable == 0 && damaged == 0 && counts[int(ReplayValidator::Verdict::Accepted)] == replays ? 0 : 1;
+	}
+	catch (const std::runtime_error& e) {
+		std::cerr << e.what() << "\n";
+		return 1;
+	}
+}